@@ -25,7 +25,9 @@
  * covered work.
  */
 
+#include <ctype.h>
 #include <err.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -34,111 +36,458 @@
 #include <wchar.h>
 #include <wctype.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "chat.h"
+#include "width.h"
 
 struct Lines {
+	size_t cap;
 	size_t len;
-	struct Line lines[BufferCap];
+	struct Line *lines;
 };
 _Static_assert(!(BufferCap & (BufferCap - 1)), "BufferCap is power of two");
 
+static void linesAlloc(struct Lines *lines, size_t cap) {
+	lines->cap = cap;
+	lines->lines = calloc(cap, sizeof(*lines->lines));
+	if (!lines->lines) err(1, "calloc");
+}
+
+static void linesFree(struct Lines *lines) {
+	for (size_t i = 0; i < lines->cap; ++i) {
+		free(lines->lines[i].str);
+		free(lines->lines[i].runs);
+	}
+	free(lines->lines);
+	*lines = (struct Lines) {0};
+}
+
+// Full blocks of soft lines which are older than anything visible or unread
+// have their strings packed together and compressed.
+enum { BlockLines = 256 };
+_Static_assert(!(BufferCap % BlockLines), "BlockLines divides BufferCap");
+
+struct Block {
+	bool raw;
+	size_t len;
+	size_t size;
+	byte *data;
+};
+
+// Every soft line flowed to one width, whatever its heat, with an index of
+// the hard lines visible at each threshold. Changing threshold only switches
+// index, and only a change of width reflows.
+struct View {
+	size_t len;
+	uint pos[BufferCap];
+};
+struct Layout {
+	int cols;
+	struct Lines hard;
+	struct View views[Hot + 1];
+};
+
+// Each row is the set of soft lines containing a trigram with that hash,
+// ignoring case and formatting.
+enum { GramCap = 256 };
+
 struct Buffer {
 	struct Lines soft;
-	struct Lines hard;
+	uint64_t grams[GramCap][BufferCap / 64];
+	struct Layout layout;
+	enum Heat thresh;
+	struct {
+		size_t len;
+		uint nums[BufferCap];
+	} hot;
+	struct Block blocks[BufferCap / BlockLines];
 };
 
+struct BufferStats bufferStats;
+
 struct Buffer *bufferAlloc(void) {
 	struct Buffer *buffer = calloc(1, sizeof(*buffer));
 	if (!buffer) err(1, "calloc");
+	linesAlloc(&buffer->soft, BufferCap);
 	return buffer;
 }
 
+static struct {
+	const struct Block *block;
+	char *buf;
+	size_t cap;
+	char *strs[BlockLines];
+} unpacked;
+
+// Candidates for the last search, less the lines found not to match it, so
+// that a search extending it only checks what is left.
+static struct {
+	const struct Buffer *buffer;
+	size_t len;
+	char *str;
+	uint64_t bits[BufferCap / 64];
+} found;
+
+static uint64_t nsec(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void blockUnpack(const struct Block *block) {
+	if (unpacked.block == block) return;
+	uint64_t start = nsec();
+	if (unpacked.cap < block->len) {
+		char *buf = realloc(unpacked.buf, block->len);
+		if (!buf) err(1, "realloc");
+		unpacked.buf = buf;
+		unpacked.cap = block->len;
+	}
+	size_t len = lzDecompress(
+		(byte *)unpacked.buf, block->len, block->data, block->size
+	);
+	if (len != block->len) errx(1, "corrupt scrollback block");
+	char *str = unpacked.buf;
+	for (size_t i = 0; i < BlockLines; ++i) {
+		unpacked.strs[i] = str;
+		str += strlen(str) + 1;
+	}
+	unpacked.block = block;
+
+	uint64_t time = nsec() - start;
+	bufferStats.unpacks++;
+	bufferStats.unpackTime += time;
+	if (time > bufferStats.unpackMax) bufferStats.unpackMax = time;
+}
+
+static void blockPack(struct Buffer *buffer, size_t b) {
+	struct Block *block = &buffer->blocks[b];
+	struct Line *lines = &buffer->soft.lines[b * BlockLines];
+
+	size_t len = 0;
+	for (size_t i = 0; i < BlockLines; ++i) {
+		len += strlen(lines[i].str) + 1;
+	}
+	char *buf = malloc(len);
+	if (!buf) err(1, "malloc");
+	char *ptr = buf;
+	for (size_t i = 0; i < BlockLines; ++i) {
+		size_t n = strlen(lines[i].str) + 1;
+		memcpy(ptr, lines[i].str, n);
+		ptr += n;
+	}
+
+	size_t cap = lzBound(len);
+	byte *data = malloc(cap);
+	if (!data) err(1, "malloc");
+	size_t size = lzCompress(data, cap, (byte *)buf, len);
+	free(buf);
+	if (!size || size >= len) {
+		free(data);
+		block->raw = true;
+		return;
+	}
+	block->data = realloc(data, size);
+	if (!block->data) err(1, "realloc");
+	block->len = len;
+	block->size = size;
+
+	for (size_t i = 0; i < BlockLines; ++i) {
+		free(lines[i].str);
+		lines[i].str = NULL;
+	}
+	bufferStats.blocks++;
+	bufferStats.raw += len;
+	bufferStats.packed += size;
+}
+
+static void blockThaw(struct Buffer *buffer, size_t b) {
+	struct Block *block = &buffer->blocks[b];
+	if (!block->data) return;
+	blockUnpack(block);
+	struct Line *lines = &buffer->soft.lines[b * BlockLines];
+	for (size_t i = 0; i < BlockLines; ++i) {
+		lines[i].str = strdup(unpacked.strs[i]);
+		if (!lines[i].str) err(1, "strdup");
+	}
+	bufferStats.blocks--;
+	bufferStats.raw -= block->len;
+	bufferStats.packed -= block->size;
+	free(block->data);
+	*block = (struct Block) {0};
+	unpacked.block = NULL;
+}
+
 void bufferFree(struct Buffer *buffer) {
-	for (size_t i = 0; i < BufferCap; ++i) {
-		free(buffer->soft.lines[i].str);
-		free(buffer->hard.lines[i].str);
+	for (size_t b = 0; b < ARRAY_LEN(buffer->blocks); ++b) {
+		struct Block *block = &buffer->blocks[b];
+		if (!block->data) continue;
+		bufferStats.blocks--;
+		bufferStats.raw -= block->len;
+		bufferStats.packed -= block->size;
+		free(block->data);
 	}
+	unpacked.block = NULL;
+	if (found.buffer == buffer) found.buffer = NULL;
+	linesFree(&buffer->soft);
+	linesFree(&buffer->layout.hard);
 	free(buffer);
 }
 
 static const struct Line *linesLine(const struct Lines *lines, size_t i) {
-	const struct Line *line = &lines->lines[(lines->len + i) % BufferCap];
+	const struct Line *line = &lines->lines[(lines->len + i) % lines->cap];
 	return (line->str ? line : NULL);
 }
 
 static struct Line *linesNext(struct Lines *lines) {
-	struct Line *line = &lines->lines[lines->len++ % BufferCap];
+	struct Line *line = &lines->lines[lines->len++ % lines->cap];
 	free(line->str);
+	free(line->runs);
+	line->runs = NULL;
 	return line;
 }
 
 const struct Line *bufferSoft(const struct Buffer *buffer, size_t i) {
-	return linesLine(&buffer->soft, i);
+	size_t index = (buffer->soft.len + i) % BufferCap;
+	const struct Block *block = &buffer->blocks[index / BlockLines];
+	if (!block->data) return linesLine(&buffer->soft, i);
+	blockUnpack(block);
+	static struct Line line;
+	line = buffer->soft.lines[index];
+	line.str = unpacked.strs[index % BlockLines];
+	return &line;
 }
 
-const struct Line *bufferHard(const struct Buffer *buffer, size_t i) {
-	return linesLine(&buffer->hard, i);
+// Hard lines of packed blocks keep their num, heat and time but drop their
+// strings, which are flowed again from the soft line when asked for.
+static void hardDrop(struct Line *line) {
+	free(line->str);
+	free(line->runs);
+	line->str = NULL;
+	line->runs = NULL;
+	line->nruns = 0;
 }
 
-enum { StyleCap = 10 };
-static char *styleCopy(char *ptr, char *end, struct Style style) {
-	ptr = seprintf(
-		ptr, end, "%s%s%s%s",
-		(style.attr & Bold ? (const char []) { B, '\0' } : ""),
-		(style.attr & Reverse ? (const char []) { R, '\0' } : ""),
-		(style.attr & Italic ? (const char []) { I, '\0' } : ""),
-		(style.attr & Underline ? (const char []) { U, '\0' } : "")
-	);
-	if (style.fg != Default || style.bg != Default) {
-		ptr = seprintf(ptr, end, "\3%02d,%02d", style.fg, style.bg);
+static size_t hardPos(const struct Buffer *buffer, size_t i) {
+	const struct Layout *layout = &buffer->layout;
+	if (!layout->hard.lines) return SIZE_MAX;
+	const struct View *view = &layout->views[buffer->thresh];
+	if (view->len + i < BufferCap) return SIZE_MAX;
+	uint pos = view->pos[(view->len + i) % BufferCap];
+	if ((uint)layout->hard.len - pos > BufferCap) return SIZE_MAX;
+	return pos;
+}
+
+// Measure the run of printable ASCII at the start of str, noting one past the
+// last space and hyphen in it, since those are the only wrap points there.
+static size_t asciiRun(
+	const char *str, size_t len, size_t *space, size_t *hyphen
+) {
+	size_t n = 0;
+#if defined(__AVX2__)
+	const __m256i lo = _mm256_set1_epi8(' ' - 1);
+	const __m256i hi = _mm256_set1_epi8('~' + 1);
+	const __m256i sp = _mm256_set1_epi8(' ');
+	const __m256i hy = _mm256_set1_epi8('-');
+	for (; n + 32 <= len; n += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)&str[n]);
+		uint32_t ok = _mm256_movemask_epi8(_mm256_and_si256(
+			_mm256_cmpgt_epi8(v, lo), _mm256_cmpgt_epi8(hi, v)
+		));
+		uint run = (~ok ? __builtin_ctz(~ok) : 32);
+		uint32_t keep = (run < 32 ? (1u << run) - 1 : ~0u);
+		uint32_t s = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, sp)) & keep;
+		uint32_t h = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, hy)) & keep;
+		if (s) *space = n + 32 - __builtin_clz(s);
+		if (h) *hyphen = n + 32 - __builtin_clz(h);
+		if (run < 32) return n + run;
+	}
+#elif defined(__SSE2__)
+	const __m128i lo = _mm_set1_epi8(' ' - 1);
+	const __m128i hi = _mm_set1_epi8('~' + 1);
+	const __m128i sp = _mm_set1_epi8(' ');
+	const __m128i hy = _mm_set1_epi8('-');
+	for (; n + 16 <= len; n += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)&str[n]);
+		uint ok = _mm_movemask_epi8(_mm_and_si128(
+			_mm_cmpgt_epi8(v, lo), _mm_cmplt_epi8(v, hi)
+		));
+		uint run = (ok != 0xFFFF ? __builtin_ctz(~ok) : 16);
+		uint keep = (1u << run) - 1;
+		uint s = _mm_movemask_epi8(_mm_cmpeq_epi8(v, sp)) & keep;
+		uint h = _mm_movemask_epi8(_mm_cmpeq_epi8(v, hy)) & keep;
+		if (s) *space = n + 32 - __builtin_clz(s);
+		if (h) *hyphen = n + 32 - __builtin_clz(h);
+		if (run < 16) return n + run;
 	}
-	return ptr;
+#endif
+	for (; n < len; ++n) {
+		if (str[n] < ' ' || str[n] > '~') break;
+		if (str[n] == ' ') *space = n + 1;
+		if (str[n] == '-') *hyphen = n + 1;
+	}
+	return n;
 }
 
-static const wchar_t ZWS = L'\u200B';
-static const wchar_t ZWNJ = L'\u200C';
+static bool styleEq(struct Style a, struct Style b) {
+	return a.attr == b.attr && a.fg == b.fg && a.bg == b.bg;
+}
 
-static int flow(struct Lines *hard, int cols, const struct Line *soft) {
-	int flowed = 1;
+// The soft line currently being flowed, with its formatting parsed out into
+// plain text and the runs of style over it.
+static struct {
+	char *str;
+	size_t cap;
+	struct Run *runs;
+	size_t nruns;
+	size_t runCap;
+} parsed;
+
+static void runPush(size_t pos, struct Style style) {
+	if (parsed.nruns) {
+		struct Run *last = &parsed.runs[parsed.nruns - 1];
+		if (styleEq(last->style, style)) return;
+		if (last->pos == pos) {
+			last->style = style;
+			if (parsed.nruns < 2 || !styleEq(last[-1].style, style)) return;
+			parsed.nruns--;
+			return;
+		}
+	}
+	if (parsed.nruns == parsed.runCap) {
+		size_t cap = (parsed.runCap ? parsed.runCap * 2 : 16);
+		struct Run *runs = realloc(parsed.runs, sizeof(*runs) * cap);
+		if (!runs) err(1, "realloc");
+		parsed.runs = runs;
+		parsed.runCap = cap;
+	}
+	parsed.runs[parsed.nruns++] = (struct Run) { pos, style };
+}
 
+static size_t parse(const char *str) {
+	size_t cap = strlen(str) + 1;
+	if (cap > parsed.cap) {
+		char *buf = realloc(parsed.str, cap);
+		if (!buf) err(1, "realloc");
+		parsed.str = buf;
+		parsed.cap = cap;
+	}
+	parsed.nruns = 0;
+
+	size_t len = 0;
+	struct Style style = StyleDefault;
+	runPush(0, style);
+	while (*str) {
+		size_t n = styleParse(&style, &str);
+		if (!n) continue;
+		runPush(len, style);
+		for (const char *end = &str[n]; str < end;) {
+			// ncurses likes to render ZWS and ZWNJ as spaces when they should
+			// be zero-width, so just remove them entirely.
+			if (
+				end - str >= 3 && str[0] == '\xE2' && str[1] == '\x80' &&
+				(str[2] == '\x8B' || str[2] == '\x8C')
+			) {
+				str += 3;
+				continue;
+			}
+			parsed.str[len++] = *str++;
+		}
+	}
+	parsed.str[len] = '\0';
+	return len;
+}
+
+// Copy parsed text from start to end into a new hard line, indented by spaces.
+static void linePush(
+	struct Lines *hard, const struct Line *soft, time_t time,
+	size_t indent, size_t start, size_t end
+) {
 	struct Line *line = linesNext(hard);
 	line->num = soft->num;
 	line->heat = soft->heat;
-	line->time = soft->time;
-	line->str = strdup(soft->str);
-	if (!line->str) err(1, "strdup");
+	line->time = time;
+
+	line->str = malloc(indent + end - start + 1);
+	if (!line->str) err(1, "malloc");
+	memset(line->str, ' ', indent);
+	memcpy(&line->str[indent], &parsed.str[start], end - start);
+	line->str[indent + end - start] = '\0';
 
+	size_t first = 0;
+	while (first + 1 < parsed.nruns && parsed.runs[first + 1].pos <= start) {
+		first++;
+	}
+	size_t last = first + 1;
+	while (last < parsed.nruns && parsed.runs[last].pos < end) last++;
+
+	struct Style style = parsed.runs[first].style;
+	bool pad = (indent && !styleEq(style, StyleDefault));
+	line->nruns = pad + last - first;
+	line->runs = malloc(sizeof(*line->runs) * line->nruns);
+	if (!line->runs) err(1, "malloc");
+
+	struct Run *run = line->runs;
+	if (pad) *run++ = (struct Run) { 0, StyleDefault };
+	*run++ = (struct Run) { (pad ? indent : 0), style };
+	for (size_t i = first + 1; i < last; ++i) {
+		*run++ = (struct Run) {
+			indent + parsed.runs[i].pos - start, parsed.runs[i].style
+		};
+	}
+}
+
+static int flow(struct Lines *hard, int cols, const struct Line *soft) {
+	size_t len = parse(soft->str);
+	char *text = parsed.str;
+	char *end = &text[len];
+
+	int flowed = 1;
 	int width = 0;
 	int align = 0;
+	int indent = 0;
+	char *line = text;
 	char *wrap = NULL;
-	struct Style style = StyleDefault;
-	struct Style wrapStyle = StyleDefault;
-	for (char *str = line->str; *str;) {
-		size_t len = styleParse(&style, (const char **)&str);
-		if (!len) continue;
+	for (char *str = text; str < end;) {
+		if (width < cols) {
+			size_t space = 0, hyphen = 0;
+			size_t max = cols - width;
+			size_t run = asciiRun(
+				str, ((size_t)(end - str) < max ? (size_t)(end - str) : max),
+				&space, &hyphen
+			);
+			if (space > hyphen) {
+				wrap = &str[space - 1];
+			} else if (hyphen) {
+				wrap = &str[hyphen];
+			}
+			width += run;
+			str += run;
+			if (run) continue;
+		}
 
 		bool tab = (*str == '\t' && !align);
 		if (tab) *str = ' ';
 
 		wchar_t wc = L'\0';
-		int n = mbtowc(&wc, str, len);
+		int n = mbtowc(&wc, str, end - str);
 		if (n < 0) {
 			n = 1;
 			// ncurses will render these as "~A".
 			width += (*str & '\200' ? 2 : 1);
-		} else if (wc == ZWS || wc == ZWNJ) {
-			// ncurses likes to render these as spaces when they should be
-			// zero-width, so just remove them entirely.
-			memmove(str, &str[n], strlen(&str[n]) + 1);
-			continue;
 		} else if (wc == L'\t') {
 			// Assuming TABSIZE = 8.
 			width += 8 - (width % 8);
 		} else if (wc < L' ' || wc == L'\177') {
 			// ncurses will render these as "^A".
 			width += 2;
-		} else if (wcwidth(wc) > 0) {
-			width += wcwidth(wc);
+		} else if (charWidth(wc) > 0) {
+			width += charWidth(wc);
 		}
 
 		if (tab && width < cols) {
@@ -147,11 +496,9 @@ static int flow(struct Lines *hard, int cols, const struct Line *soft) {
 		}
 		if (iswspace(wc) && !tab) {
 			wrap = str;
-			wrapStyle = style;
 		}
 		if (wc == L'-' && width <= cols) {
 			wrap = &str[n];
-			wrapStyle = style;
 		}
 
 		if (width <= cols) {
@@ -159,74 +506,330 @@ static int flow(struct Lines *hard, int cols, const struct Line *soft) {
 			continue;
 		} else if (!wrap) {
 			wrap = str;
-			wrapStyle = style;
 		}
 
-		n = 0;
-		len = strlen(wrap);
-		for (int m; wrap[n] && (m = mbtowc(&wc, &wrap[n], len - n)); n += m) {
+		str = wrap;
+		for (int m; str < end && (m = mbtowc(&wc, str, end - str)); str += m) {
 			if (m < 0) {
 				m = 1;
 			} else if (!iswspace(wc)) {
 				break;
 			}
 		}
-		if (!wrap[n]) {
-			*wrap = '\0';
+		if (str == end) {
+			end = wrap;
 			break;
 		}
 
+		linePush(
+			hard, soft, (line == text ? soft->time : 0),
+			indent, line - text, wrap - text
+		);
 		flowed++;
-		line = linesNext(hard);
-		line->num = soft->num;
-		line->heat = soft->heat;
-		line->time = 0;
-
-		size_t cap = StyleCap + align + strlen(&wrap[n]) + 1;
-		line->str = malloc(cap);
-		if (!line->str) err(1, "malloc");
-
-		char *end = &line->str[cap];
-		str = seprintf(line->str, end, "%*s", (width = align), "");
-		str = styleCopy(str, end, wrapStyle);
-		style = wrapStyle;
-		seprintf(str, end, "%s", &wrap[n]);
-
-		*wrap = '\0';
+		line = str;
+		width = indent = align;
 		wrap = NULL;
 	}
+	linePush(
+		hard, soft, (line == text ? soft->time : 0),
+		indent, line - text, end - text
+	);
 
 	return flowed;
 }
 
+// A dropped hard line is found in its soft line flowed again by counting back
+// from the end, since the hard lines after it are newer and still in the ring.
+const struct Line *bufferHard(const struct Buffer *buffer, size_t i) {
+	size_t pos = hardPos(buffer, i);
+	if (pos == SIZE_MAX) return NULL;
+	const struct Lines *hard = &buffer->layout.hard;
+	const struct Line *line = &hard->lines[pos % BufferCap];
+	if (line->str) return line;
+
+	size_t after = 0;
+	while (
+		pos + after + 1 < hard->len &&
+		hard->lines[(pos + after + 1) % BufferCap].num == line->num
+	) after++;
+	const struct Line *soft = bufferSoft(
+		buffer, BufferCap - 1 - (buffer->soft.len - line->num)
+	);
+	if (!soft) return NULL;
+
+	static struct Lines flowed;
+	if (!flowed.lines) linesAlloc(&flowed, BufferCap);
+	flowed.len = 0;
+	int n = flow(&flowed, buffer->layout.cols, soft);
+	return &flowed.lines[(n - 1 - after) % BufferCap];
+}
+
+static void layoutDrop(struct Layout *layout, uint first, uint last) {
+	struct Lines *hard = &layout->hard;
+	size_t pos = (hard->len > BufferCap ? hard->len - BufferCap : 0);
+	for (; pos < hard->len; ++pos) {
+		struct Line *line = &hard->lines[pos % BufferCap];
+		if (line->num > last) break;
+		if (line->num >= first) hardDrop(line);
+	}
+}
+
+static int layoutPush(struct Layout *layout, const struct Line *soft) {
+	int n = flow(&layout->hard, layout->cols, soft);
+	for (enum Heat heat = Ice; heat <= soft->heat; ++heat) {
+		struct View *view = &layout->views[heat];
+		for (int i = n; i; --i) {
+			view->pos[view->len++ % BufferCap] = layout->hard.len - i;
+		}
+	}
+	return n;
+}
+
+static void layoutSelect(struct Buffer *buffer, int cols, enum Heat thresh) {
+	buffer->thresh = thresh;
+	struct Layout *layout = &buffer->layout;
+	if (layout->hard.lines && layout->cols == cols) return;
+	linesFree(&layout->hard);
+	linesAlloc(&layout->hard, BufferCap);
+	layout->cols = cols;
+	for (size_t i = 0; i < ARRAY_LEN(layout->views); ++i) {
+		layout->views[i].len = 0;
+	}
+	for (size_t i = 0; i < BufferCap; ++i) {
+		const struct Line *soft = bufferSoft(buffer, i);
+		if (!soft) continue;
+		int n = layoutPush(layout, soft);
+		size_t index = (buffer->soft.len + i) % BufferCap;
+		if (!buffer->blocks[index / BlockLines].data) continue;
+		for (size_t pos = layout->hard.len - n; pos < layout->hard.len; ++pos) {
+			hardDrop(&layout->hard.lines[pos % BufferCap]);
+		}
+	}
+}
+
+static uint gramHash(const char *str) {
+	uint hash = 0;
+	for (int i = 0; i < 3; ++i) {
+		hash = hash * 31 + tolower((unsigned char)str[i]);
+	}
+	return hash % GramCap;
+}
+
+static void gramsIndex(struct Buffer *buffer, size_t index, const char *str) {
+	uint64_t bit = 1ull << (index % 64);
+	for (size_t g = 0; g < GramCap; ++g) {
+		buffer->grams[g][index / 64] &= ~bit;
+	}
+	size_t len = parse(str);
+	for (size_t i = 0; i + 3 <= len; ++i) {
+		buffer->grams[gramHash(&parsed.str[i])][index / 64] |= bit;
+	}
+}
+
 int bufferPush(
 	struct Buffer *buffer, int cols, enum Heat thresh,
 	enum Heat heat, time_t time, const char *str
 ) {
+	layoutSelect(buffer, cols, thresh);
+	size_t index = buffer->soft.len % BufferCap;
+	if (!(index % BlockLines)) {
+		blockThaw(buffer, index / BlockLines);
+		buffer->blocks[index / BlockLines].raw = false;
+	}
 	struct Line *soft = linesNext(&buffer->soft);
 	soft->num = buffer->soft.len;
 	soft->heat = heat;
 	soft->time = time;
 	soft->str = strdup(str);
 	if (!soft->str) err(1, "strdup");
-	if (heat < thresh) return 0;
-	return flow(&buffer->hard, cols, soft);
+	gramsIndex(buffer, index, soft->str);
+	if (heat >= Hot) {
+		buffer->hot.nums[buffer->hot.len++ % BufferCap] = soft->num;
+	}
+	int flowed = layoutPush(&buffer->layout, soft);
+	return (heat < thresh ? 0 : flowed);
 }
 
 int
 bufferReflow(struct Buffer *buffer, int cols, enum Heat thresh, size_t tail) {
-	buffer->hard.len = 0;
-	for (size_t i = 0; i < BufferCap; ++i) {
-		free(buffer->hard.lines[i].str);
-		buffer->hard.lines[i].str = NULL;
+	layoutSelect(buffer, cols, thresh);
+	if (tail >= buffer->soft.len) tail = buffer->soft.len;
+	return BufferCap - bufferFind(buffer, buffer->soft.len - tail + 1);
+}
+
+// Hard lines are in order of num, so binary search for the first at or after
+// num, which may itself be hidden by the threshold.
+size_t bufferFind(const struct Buffer *buffer, uint num) {
+	size_t lo = 0, hi = BufferCap;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		size_t pos = hardPos(buffer, mid);
+		const struct Lines *hard = &buffer->layout.hard;
+		if (pos != SIZE_MAX && hard->lines[pos % BufferCap].num >= num) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
 	}
-	int flowed = 0;
-	for (size_t i = 0; i < BufferCap; ++i) {
+	return lo;
+}
+
+// Hot line nums are pushed in order, so binary search for the first at or
+// after num, returning an index into the ring of them.
+static size_t hotFind(const struct Buffer *buffer, uint num) {
+	size_t lo = 0, hi = buffer->hot.len;
+	if (hi > BufferCap) lo = hi - BufferCap;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (buffer->hot.nums[mid % BufferCap] >= num) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return lo;
+}
+
+static size_t hotFirst(const struct Buffer *buffer) {
+	size_t len = buffer->soft.len;
+	return hotFind(buffer, (len > BufferCap ? len - BufferCap + 1 : 1));
+}
+
+uint bufferHot(const struct Buffer *buffer, uint num, int dir) {
+	if (dir > 0) {
+		size_t i = hotFind(buffer, num + 1);
+		if (i < hotFirst(buffer)) i = hotFirst(buffer);
+		return (i < buffer->hot.len ? buffer->hot.nums[i % BufferCap] : 0);
+	} else {
+		size_t i = hotFind(buffer, num);
+		if (i <= hotFirst(buffer)) return 0;
+		return buffer->hot.nums[(i - 1) % BufferCap];
+	}
+}
+
+size_t bufferHotRank(const struct Buffer *buffer, uint num, size_t *total) {
+	size_t first = hotFirst(buffer);
+	*total = buffer->hot.len - first;
+	size_t i = hotFind(buffer, num + 1);
+	return (i > first ? i - first : 0);
+}
+
+const struct Line *bufferSearch(
+	const struct Buffer *buffer, const char *str, uint num, int dir
+) {
+	size_t len = strlen(str);
+	bool narrow = found.buffer == buffer
+		&& found.len == buffer->soft.len
+		&& !strncmp(found.str, str, strlen(found.str));
+	if (!narrow) memset(found.bits, 0xFF, sizeof(found.bits));
+	for (size_t i = 0; i + 3 <= len; ++i) {
+		const uint64_t *row = buffer->grams[gramHash(&str[i])];
+		for (size_t w = 0; w < ARRAY_LEN(found.bits); ++w) {
+			found.bits[w] &= row[w];
+		}
+	}
+	free(found.str);
+	found.str = strdup(str);
+	if (!found.str) err(1, "strdup");
+	found.buffer = buffer;
+	found.len = buffer->soft.len;
+
+	uint last = buffer->soft.len;
+	uint first = (last > BufferCap ? last - BufferCap + 1 : 1);
+	uint n = num + dir;
+	if (dir > 0 && n < first) n = first;
+	if (dir < 0 && n > last) n = last;
+	for (; n >= first && n <= last; n += dir) {
+		size_t index = (n - 1) % BufferCap;
+		uint64_t bit = 1ull << (index % 64);
+		if (!(found.bits[index / 64] & bit)) continue;
+		size_t i = BufferCap - 1 - (last - n);
 		const struct Line *soft = bufferSoft(buffer, i);
 		if (!soft) continue;
-		if (soft->heat < thresh) continue;
-		int n = flow(&buffer->hard, cols, soft);
-		if (i >= BufferCap - tail) flowed += n;
+		parse(soft->str);
+		if (!strcasestr(parsed.str, str)) {
+			found.bits[index / 64] &= ~bit;
+			continue;
+		}
+		if (soft->heat < buffer->thresh) continue;
+		return soft;
+	}
+	return NULL;
+}
+
+void bufferCool(struct Buffer *buffer, uint num, size_t tail) {
+	size_t next = buffer->soft.len % BufferCap / BlockLines;
+	for (size_t b = 0; b < ARRAY_LEN(buffer->blocks); ++b) {
+		const struct Block *block = &buffer->blocks[b];
+		if (b == next || block->data || block->raw) continue;
+		const struct Line *last = &buffer->soft.lines[(b + 1) * BlockLines - 1];
+		if (!last->str || last->num >= num) continue;
+		if (last->num + tail > buffer->soft.len) continue;
+		blockPack(buffer, b);
+		if (!block->data) continue;
+		const struct Line *first = &buffer->soft.lines[b * BlockLines];
+		layoutDrop(&buffer->layout, first->num, last->num);
 	}
-	return flowed;
 }
+
+#ifdef BENCH
+#include <locale.h>
+
+static const char *Corpora[][4] = {
+	{
+		"ascii",
+		"and then the build fell over again because somebody pushed to",
+		"master without running the tests, which is why we can't have",
+		"nice things - see https://example.org/ci/builds/12345 for logs",
+	},
+	{
+		"cjk",
+		"日本語のテキストを折り返すときには全角文字の幅を正しく",
+		"数える必要があります。中文的文字也是一样的，每个字",
+		"占两列。한국어 문장도 마찬가지로 두 칸을 차지합니다.",
+	},
+	{
+		"emoji",
+		"🎉🎉 shipped it 🚀🚀🚀 thanks everyone 🙏 ❤️ 😂😂😂",
+		"👀 did anyone see the 🐛 in #general 🤔 it's 🔥🔥",
+		"✨ 🐱 nyaa~ 🐈‍⬛ 🌸🌸🌸 good night 🌙 💤",
+	},
+};
+
+int main(void) {
+	setlocale(LC_CTYPE, "");
+	if (MB_CUR_MAX == 1) warnx("locale is not multibyte");
+
+	enum { Lines = 64 * BufferCap, Reflows = 32 };
+	for (size_t c = 0; c < ARRAY_LEN(Corpora); ++c) {
+		char strs[3][512];
+		for (size_t i = 0; i < ARRAY_LEN(strs); ++i) {
+			snprintf(
+				strs[i], sizeof(strs[i]), "\3%02zu<nick%zu>\3\t%s %s",
+				2 + i, i, Corpora[c][1 + i], Corpora[c][1 + (i + 1) % 3]
+			);
+		}
+
+		struct Buffer *buffer = bufferAlloc();
+		uint64_t start = nsec();
+		for (size_t i = 0; i < Lines; ++i) {
+			bufferPush(buffer, 80, Cold, Cold, i, strs[i % 3]);
+		}
+		uint64_t push = nsec() - start;
+
+		start = nsec();
+		for (int i = 0; i < Reflows; ++i) {
+			bufferReflow(buffer, 60 + i % 3 * 30, Cold, 0);
+		}
+		uint64_t reflow = nsec() - start;
+		bufferFree(buffer);
+
+		printf(
+			"%-5s  bufferPush %5" PRIu64 " ns/line"
+			"  bufferReflow %5" PRIu64 " ns/line\n",
+			Corpora[c][0], push / Lines, reflow / Reflows / BufferCap
+		);
+	}
+}
+
+#endif /* BENCH */
@@ -25,6 +25,7 @@
  * covered work.
  */
 
+#include <ctype.h>
 #include <err.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -157,9 +158,9 @@ static void sandboxEarly(bool log) {
 
 	if (log) {
 		char buf[PATH_MAX];
-		int error = unveil(dataPath(buf, sizeof(buf), "log", 0), "wc");
+		int error = unveil(dataPath(buf, sizeof(buf), "log", 0), "rwc");
 		if (error) err(1, "unveil");
-		ptr = seprintf(ptr, end, " wpath cpath");
+		ptr = seprintf(ptr, end, " rpath wpath cpath");
 	}
 
 	if (!self.restricted) {
@@ -241,14 +242,23 @@ int main(int argc, char *argv[]) {
 
 	struct option options[] = {
 		{ .val = '!', .name = "insecure", no_argument },
+		{ .val = 'B', .name = "log-backlog", no_argument },
 		{ .val = 'C', .name = "copy", required_argument },
+		{ .val = 'F', .name = "frame-rate", required_argument },
 		{ .val = 'H', .name = "hash", required_argument },
 		{ .val = 'I', .name = "highlight", required_argument },
+		{ .val = 'J', .name = "journal", required_argument },
+		{ .val = 'L', .name = "log-flush", required_argument },
 		{ .val = 'N', .name = "notify", required_argument },
 		{ .val = 'O', .name = "open", required_argument },
+		{ .val = 'P', .name = "log-pack", no_argument },
 		{ .val = 'R', .name = "restrict", no_argument },
 		{ .val = 'S', .name = "bind", required_argument },
 		{ .val = 'T', .name = "timestamp", optional_argument },
+		{ .val = 'U', .name = "url-depth", required_argument },
+		{ .val = 'X', .name = "log-json", no_argument },
+		{ .val = 'Y', .name = "journal-sync", no_argument },
+		{ .val = 'Z', .name = "log-sync", no_argument },
 		{ .val = 'a', .name = "sasl-plain", required_argument },
 		{ .val = 'c', .name = "cert", required_argument },
 		{ .val = 'e', .name = "sasl-external", no_argument },
@@ -269,6 +279,7 @@ int main(int argc, char *argv[]) {
 		{ .val = 'u', .name = "user", required_argument },
 		{ .val = 'v', .name = "debug", no_argument },
 		{ .val = 'w', .name = "pass", required_argument },
+		{ .val = 'x', .name = "log-text", required_argument },
 		{0},
 	};
 	char opts[3 * ARRAY_LEN(options)];
@@ -281,17 +292,53 @@ int main(int argc, char *argv[]) {
 	for (int opt; 0 < (opt = getopt_config(argc, argv, opts, options, NULL));) {
 		switch (opt) {
 			break; case '!': insecure = true;
+			break; case 'B': logBacklog = true;
 			break; case 'C': utilPush(&urlCopyUtil, optarg);
+			break; case 'F': {
+				char *end;
+				uiFrameRate = strtoul(optarg, &end, 10);
+				if (!isdigit(optarg[0]) || *end || !uiFrameRate) {
+					errx(1, "invalid frame rate");
+				}
+			}
 			break; case 'H': parseHash(optarg);
 			break; case 'I': filterAdd(Hot, optarg);
+			break; case 'J': {
+				char *end;
+				unsigned long ms = strtoul(optarg, &end, 10);
+				if (!isdigit(optarg[0]) || *end || ms > INT_MAX) {
+					errx(1, "invalid journal interval");
+				}
+				uiJournalInterval = ms;
+			}
+			break; case 'L': {
+				char *end;
+				unsigned long ms = strtoul(optarg, &end, 10);
+				if (!isdigit(optarg[0]) || *end || ms > INT_MAX) {
+					errx(1, "invalid log flush interval");
+				}
+				logInterval = ms;
+			}
 			break; case 'N': utilPush(&uiNotifyUtil, optarg);
 			break; case 'O': utilPush(&urlOpenUtil, optarg);
+			break; case 'P': logPack = true;
 			break; case 'R': self.restricted = true;
 			break; case 'S': bind = optarg;
 			break; case 'T': {
 				windowTime.enable = true;
 				if (optarg) windowTime.format = optarg;
 			}
+			break; case 'U': {
+				char *end;
+				unsigned long depth = strtoul(optarg, &end, 10);
+				if (!isdigit(optarg[0]) || *end || depth > UINT_MAX) {
+					errx(1, "invalid URL depth");
+				}
+				urlDepth = depth;
+			}
+			break; case 'X': logJSON = true;
+			break; case 'Y': uiJournalSync = true;
+			break; case 'Z': logSync = true;
 			break; case 'a': sasl = true; parsePlain(optarg);
 			break; case 'c': cert = optarg;
 			break; case 'e': sasl = true;
@@ -300,7 +347,7 @@ int main(int argc, char *argv[]) {
 			break; case 'i': filterAdd(Ice, optarg);
 			break; case 'j': self.join = optarg;
 			break; case 'k': priv = optarg;
-			break; case 'l': log = true; logOpen();
+			break; case 'l': log = true;
 			break; case 'm': self.mode = optarg;
 			break; case 'n': {
 				for (uint i = 0; i < ARRAY_LEN(self.nicks); ++i) {
@@ -316,10 +363,12 @@ int main(int argc, char *argv[]) {
 			break; case 'u': user = optarg;
 			break; case 'v': self.debug = true;
 			break; case 'w': pass = optarg;
+			break; case 'x': logText(optarg); return 0;
 			break; default:  return 1;
 		}
 	}
 	if (!host) errx(1, "host required");
+	if (log) logOpen();
 
 	if (printCert) {
 #ifdef __OpenBSD__
@@ -420,6 +469,7 @@ int main(int argc, char *argv[]) {
 	}
 
 	bool ping = false;
+	int timeout = -1;
 	struct pollfd fds[] = {
 		{ .events = POLLIN, .fd = STDIN_FILENO },
 		{ .events = POLLIN, .fd = irc },
@@ -427,7 +477,9 @@ int main(int argc, char *argv[]) {
 		{ .events = POLLIN, .fd = execPipe[0] },
 	};
 	while (!self.quit) {
-		int nfds = poll(fds, (self.restricted ? 2 : ARRAY_LEN(fds)), -1);
+		int nfds = poll(
+			fds, (self.restricted ? 2 : ARRAY_LEN(fds)), timeout
+		);
 		if (nfds < 0 && errno != EINTR) err(1, "poll");
 		if (nfds > 0) {
 			if (fds[0].revents) inputRead();
@@ -485,7 +537,14 @@ int main(int argc, char *argv[]) {
 			inputRead();
 		}
 
-		uiDraw();
+		timeout = uiFrame(nfds > 0 && fds[0].revents);
+		int journal = uiJournal();
+		if (journal >= 0 && (timeout < 0 || journal < timeout)) {
+			timeout = journal;
+		}
+		int pack = logIdle();
+		if (pack >= 0 && (timeout < 0 || pack < timeout)) timeout = pack;
+		if (windowIdle()) timeout = 0;
 	}
 
 	if (self.quit) {
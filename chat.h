@@ -181,6 +181,7 @@ static inline char bitPrefix(uint p) {
 }
 
 #define ENUM_CAP \
+	X("account-tag", CapAccountTag) \
 	X("causal.agency/consumer", CapConsumer) \
 	X("chghost", CapChghost) \
 	X("extended-join", CapExtendedJoin) \
@@ -225,6 +226,7 @@ static inline void set(char **field, const char *value) {
 
 #define ENUM_TAG \
 	X("+draft/reply", TagReply) \
+	X("account", TagAccount) \
 	X("causal.agency/pos", TagPos) \
 	X("msgid", TagMsgID) \
 	X("time", TagTime)
@@ -319,18 +321,30 @@ enum {
 	InputLines = 1,
 	InputCols = 1024,
 };
+enum {
+	DrawStatus = 1 << 0,
+	DrawMain = 1 << 1,
+	DrawInput = 1 << 2,
+	DrawPads = 1 << 3,
+};
 extern char uiTitle[TitleCap];
 extern struct _win_st *uiStatus;
 extern struct _win_st *uiMain;
 extern struct _win_st *uiInput;
 extern bool uiSpoilerReveal;
 extern struct Util uiNotifyUtil;
+extern uint uiDirty;
+extern uint uiFrameRate;
+extern uint uiJournalInterval;
+extern bool uiJournalSync;
 void uiInit(void);
 uint uiAttr(struct Style style);
 short uiPair(struct Style style);
 void uiShow(void);
 void uiHide(void);
 void uiDraw(void);
+int uiFrame(bool now);
+int uiJournal(void);
 void uiResize(void);
 void uiWrite(uint id, enum Heat heat, const time_t *time, const char *str);
 void uiFormat(
@@ -339,13 +353,26 @@ void uiFormat(
 void uiLoad(const char *name);
 int uiSave(void);
 
+// FNV-1a, for checksums in the save file and journal.
+#define SumInit UINT64_C(0xCBF29CE484222325)
+static inline uint64_t sum(uint64_t hash, const void *ptr, size_t len) {
+	const byte *bytes = ptr;
+	for (size_t i = 0; i < len; ++i) {
+		hash = (hash ^ bytes[i]) * 0x100000001B3;
+	}
+	return hash;
+}
+
 void inputInit(void);
 void inputWait(void);
 void inputUpdate(void);
+void inputDraw(void);
 bool inputPending(uint id);
 void inputRead(void);
 void inputCompletion(void);
 int inputSave(FILE *file);
+bool inputChanged(void);
+int inputJournal(FILE *file);
 void inputLoad(FILE *file, size_t version);
 
 enum Scroll {
@@ -363,6 +390,7 @@ extern struct Time {
 extern enum Heat windowThreshold;
 void windowInit(void);
 void windowUpdate(void);
+void windowDraw(void);
 void windowResize(void);
 bool windowWrite(uint id, enum Heat heat, const time_t *time, const char *str);
 void windowBare(void);
@@ -383,16 +411,40 @@ void windowToggleThresh(int n);
 bool windowTimeEnable(void);
 void windowScroll(enum Scroll by, int n);
 void windowSearch(const char *str, int dir);
+void windowSearchEnd(void);
+void windowGrep(const char *str);
+bool windowHit(uint n);
+void windowBacklog(void);
+bool windowIdle(void);
 int windowSave(FILE *file);
 void windowLoad(FILE *file, size_t version);
+void windowUnmap(void);
+bool windowChanged(void);
+int windowJournal(FILE *file);
+void windowReplay(FILE *file);
+
+extern struct WindowStats {
+	size_t switches;
+	size_t hits;
+	uint64_t time;
+	uint64_t max;
+} windowStats;
 
 enum { BufferCap = 1024 };
 struct Buffer;
+struct Run {
+	uint pos;
+	struct Style style;
+};
+// Soft lines keep their formatting inline. Hard lines are plain text with
+// the style of each run starting at its byte position.
 struct Line {
 	uint num;
 	enum Heat heat;
 	time_t time;
 	char *str;
+	struct Run *runs;
+	size_t nruns;
 };
 struct Buffer *bufferAlloc(void);
 void bufferFree(struct Buffer *buffer);
@@ -405,6 +457,26 @@ int bufferPush(
 int bufferReflow(
 	struct Buffer *buffer, int cols, enum Heat thresh, size_t tail
 );
+void bufferCool(struct Buffer *buffer, uint num, size_t tail);
+size_t bufferFind(const struct Buffer *buffer, uint num);
+uint bufferHot(const struct Buffer *buffer, uint num, int dir);
+size_t bufferHotRank(const struct Buffer *buffer, uint num, size_t *total);
+const struct Line *bufferSearch(
+	const struct Buffer *buffer, const char *str, uint num, int dir
+);
+
+extern struct BufferStats {
+	size_t blocks;
+	size_t raw;
+	size_t packed;
+	size_t unpacks;
+	uint64_t unpackTime;
+	uint64_t unpackMax;
+} bufferStats;
+
+size_t lzBound(size_t len);
+size_t lzCompress(byte *dst, size_t cap, const byte *src, size_t len);
+size_t lzDecompress(byte *dst, size_t cap, const byte *src, size_t len);
 
 struct Cursor {
 	uint gen;
@@ -423,6 +495,7 @@ uint completeEachID(struct Cursor *curs, const char *str);
 void completeAccept(struct Cursor *curs);
 void completeReject(struct Cursor *curs);
 
+extern uint urlDepth;
 extern struct Util urlOpenUtil;
 extern struct Util urlCopyUtil;
 void urlScan(uint id, const char *nick, const char *mesg);
@@ -431,6 +504,15 @@ void urlOpenMatch(uint id, const char *str);
 void urlCopyMatch(uint id, const char *str);
 int urlSave(FILE *file);
 void urlLoad(FILE *file, size_t version);
+bool urlChanged(void);
+int urlJournal(FILE *file);
+
+extern struct URLStats {
+	size_t urls;
+	size_t lists;
+	size_t bytes;
+	size_t repeats;
+} urlStats;
 
 enum { FilterCap = 64 };
 extern struct Filter {
@@ -445,10 +527,60 @@ struct Filter filterAdd(enum Heat heat, const char *pattern);
 bool filterRemove(struct Filter filter);
 enum Heat filterCheck(enum Heat heat, uint id, const struct Message *msg);
 
+extern uint logInterval;
+extern bool logSync;
+extern bool logPack;
+extern bool logJSON;
+extern bool logBacklog;
 void logOpen(void);
-void logFormat(uint id, const time_t *time, const char *format, ...)
+void logFormat(uint id, const struct Message *msg, const char *format, ...)
 	__attribute__((format(printf, 3, 4)));
 void logClose(void);
+void logSearch(uint id, const char *str);
+int logIdle(void);
+void logText(const char *path);
+
+struct LogLine {
+	time_t time;
+	enum Heat heat;
+	const char *str;
+};
+size_t logLoad(uint id, struct LogLine *loaded, size_t cap);
+
+struct LogStats {
+	size_t depth;
+	size_t depthMax;
+	size_t dropped;
+	size_t written;
+	size_t batches;
+	uint64_t latency;
+	uint64_t latencyMax;
+	size_t files;
+	size_t fileCap;
+	size_t hits;
+	size_t misses;
+	size_t evictions;
+	size_t packFiles;
+	size_t packRaw;
+	size_t packPacked;
+};
+void logStats(struct LogStats *stats);
+
+enum { StampCap = 64, StampMemos = 64 };
+struct Stamp {
+	const char *format;
+	bool valid;
+	time_t minute;
+	int slot;
+	char str[StampCap];
+	struct StampMemo {
+		bool valid;
+		time_t time;
+		char str[StampCap];
+	} memo[StampMemos];
+};
+const struct tm *stampLocal(time_t time);
+const char *stampFormat(struct Stamp *stamp, const char *format, time_t time);
 
 char *configPath(char *buf, size_t cap, const char *path, int i);
 char *dataPath(char *buf, size_t cap, const char *path, int i);
@@ -27,6 +27,7 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -512,6 +513,87 @@ static void commandUnignore(uint id, char *params) {
 	commandUnfilter(Ice, id, params);
 }
 
+static void commandGrep(uint id, char *params) {
+	(void)id;
+	windowGrep(params);
+}
+
+static void commandHit(uint id, char *params) {
+	char *end = NULL;
+	uint n = (params ? strtoul(params, &end, 10) : 0);
+	if (!params || !isdigit(params[0]) || *end || !windowHit(n)) {
+		uiFormat(
+			id, Warm, NULL, "No /grep result %s", (params ?: "given")
+		);
+	}
+}
+
+static void commandHistory(uint id, char *params) {
+	if (!params) return;
+	logSearch(id, params);
+}
+
+static void commandStats(uint id, char *params) {
+	(void)params;
+	const struct BufferStats *stats = &bufferStats;
+	uiFormat(
+		id, Warm, NULL,
+		"Scrollback has %zu cold blocks packing %zu KiB into %zu KiB",
+		stats->blocks, stats->raw / 1024, stats->packed / 1024
+	);
+	uiFormat(
+		id, Warm, NULL,
+		"Scrollback blocks unpacked %zu times in %" PRIu64 " µs on average"
+		" and %" PRIu64 " µs at most",
+		stats->unpacks,
+		(stats->unpacks ? stats->unpackTime / stats->unpacks / 1000 : 0),
+		stats->unpackMax / 1000
+	);
+	const struct WindowStats *windows = &windowStats;
+	uiFormat(
+		id, Warm, NULL,
+		"Windows switched %zu times, %zu from pads, in %" PRIu64 " µs"
+		" on average and %" PRIu64 " µs at most",
+		windows->switches, windows->hits,
+		(windows->switches ? windows->time / windows->switches / 1000 : 0),
+		windows->max / 1000
+	);
+	uiFormat(
+		id, Warm, NULL,
+		"URLs kept %zu in %zu windows, indexed in %zu KiB,"
+		" with %zu repeats moved to the front",
+		urlStats.urls, urlStats.lists, urlStats.bytes / 1024,
+		urlStats.repeats
+	);
+	struct LogStats logs;
+	logStats(&logs);
+	uiFormat(
+		id, Warm, NULL,
+		"Log queue holds %zu KiB and has held %zu KiB at most,"
+		" with %zu lines dropped",
+		logs.depth / 1024, logs.depthMax / 1024, logs.dropped
+	);
+	uiFormat(
+		id, Warm, NULL,
+		"Log lines batched %zu into %zu writes, waiting %" PRIu64 " µs"
+		" on average and %" PRIu64 " µs at most",
+		logs.written, logs.batches,
+		(logs.written ? logs.latency / logs.written / 1000 : 0),
+		logs.latencyMax / 1000
+	);
+	uiFormat(
+		id, Warm, NULL,
+		"Log files open %zu of %zu, found open %zu times and opened %zu"
+		" times, with %zu closed to make room",
+		logs.files, logs.fileCap, logs.hits, logs.misses, logs.evictions
+	);
+	if (!logPack) return;
+	uiFormat(
+		id, Warm, NULL, "Log days packed %zu from %zu KiB into %zu KiB",
+		logs.packFiles, logs.packRaw / 1024, logs.packPacked / 1024
+	);
+}
+
 static void commandExec(uint id, char *params) {
 	execID = id;
 
@@ -578,8 +660,11 @@ static const struct Handler {
 	{ "/devoice", commandDevoice, 0, 0 },
 	{ "/except", commandExcept, 0, 0 },
 	{ "/exec", commandExec, Multiline | Restrict, 0 },
+	{ "/grep", commandGrep, 0, 0 },
 	{ "/help", commandHelp, 0, 0 }, // Restrict special case.
 	{ "/highlight", commandHighlight, 0, 0 },
+	{ "/history", commandHistory, 0, 0 },
+	{ "/hit", commandHit, 0, 0 },
 	{ "/ignore", commandIgnore, 0, 0 },
 	{ "/invex", commandInvex, 0, 0 },
 	{ "/invite", commandInvite, 0, 0 },
@@ -604,6 +689,7 @@ static const struct Handler {
 	{ "/quote", commandQuote, Multiline, 0 },
 	{ "/say", commandPrivmsg, Multiline, 0 },
 	{ "/setname", commandSetname, 0, CapSetname },
+	{ "/stats", commandStats, 0, 0 },
 	{ "/topic", commandTopic, 0, 0 },
 	{ "/unban", commandUnban, 0, 0 },
 	{ "/unexcept", commandUnexcept, 0, 0 },
@@ -33,6 +33,7 @@
 #include <wctype.h>
 
 #include "edit.h"
+#include "width.h"
 
 static bool isword(wchar_t ch) {
 	return !iswspace(ch) && !iswpunct(ch);
@@ -109,7 +110,7 @@ static size_t prevSpacing(const struct Edit *e, size_t pos) {
 	if (!pos) return 0;
 	do {
 		pos--;
-	} while (pos && !wcwidth(e->buf[pos]));
+	} while (pos && !charWidth(e->buf[pos]));
 	return pos;
 }
 
@@ -117,7 +118,7 @@ static size_t nextSpacing(const struct Edit *e, size_t pos) {
 	if (pos == e->len) return e->len;
 	do {
 		pos++;
-	} while (pos < e->len && !wcwidth(e->buf[pos]));
+	} while (pos < e->len && !charWidth(e->buf[pos]));
 	return pos;
 }
 
@@ -237,6 +238,14 @@ static bool eq(struct Edit *e, const char *str1) {
 #define editFn(...) assert(0 == editFn(__VA_ARGS__))
 
 int main(void) {
+	for (wchar_t ch = 0; ch < 0x80; ++ch) {
+		assert(charWidth(ch) == wcwidth(ch));
+	}
+	assert(charWidth(L'\u0301') == 0);
+	assert(charWidth(L'\u200B') == 0);
+	assert(charWidth(L'\u3042') == 2);
+	assert(charWidth(L'\U0001F431') == 2);
+
 	struct Edit cut = {0};
 	struct Edit e = { .cut = &cut };
 
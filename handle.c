@@ -349,8 +349,16 @@ static void handleReplyMOTD(struct Message *msg) {
 	}
 }
 
+// The network's name is final by the end of the MOTD, since ISUPPORT comes
+// before it.
+static void handleReplyEndOfMOTD(struct Message *msg) {
+	(void)msg;
+	windowBacklog();
+}
+
 static void handleErrorNoMOTD(struct Message *msg) {
 	(void)msg;
+	windowBacklog();
 }
 
 static void handleReplyHelp(struct Message *msg) {
@@ -390,7 +398,7 @@ static void handleJoin(struct Message *msg) {
 		(msg->params[2] ? "\17) " : ""),
 		hash(msg->params[0]), msg->params[0]
 	);
-	logFormat(id, tagTime(msg), "%s arrives in %s", msg->nick, msg->params[0]);
+	logFormat(id, msg, "%s arrives in %s", msg->nick, msg->params[0]);
 }
 
 static void handleChghost(struct Message *msg) {
@@ -421,7 +429,7 @@ static void handlePart(struct Message *msg) {
 		(msg->params[1] ? ": " : ""), (msg->params[1] ?: "")
 	);
 	logFormat(
-		id, tagTime(msg), "%s leaves %s%s%s",
+		id, msg, "%s leaves %s%s%s",
 		msg->nick, msg->params[0],
 		(msg->params[1] ? ": " : ""), (msg->params[1] ?: "")
 	);
@@ -443,7 +451,7 @@ static void handleKick(struct Message *msg) {
 		(msg->params[2] ? ": " : ""), (msg->params[2] ?: "")
 	);
 	logFormat(
-		id, tagTime(msg), "%s kicks %s out of %s%s%s",
+		id, msg, "%s kicks %s out of %s%s%s",
 		msg->nick, msg->params[1], msg->params[0],
 		(msg->params[2] ? ": " : ""), (msg->params[2] ?: "")
 	);
@@ -469,7 +477,7 @@ static void handleNick(struct Message *msg) {
 		);
 		if (id == Network) continue;
 		logFormat(
-			id, tagTime(msg), "%s is now known as %s",
+			id, msg, "%s is now known as %s",
 			msg->nick, msg->params[0]
 		);
 	}
@@ -503,7 +511,7 @@ static void handleQuit(struct Message *msg) {
 		);
 		if (id == Network) continue;
 		logFormat(
-			id, tagTime(msg), "%s leaves%s%s",
+			id, msg, "%s leaves%s%s",
 			msg->nick,
 			(msg->params[0] ? ": " : ""), (msg->params[0] ?: "")
 		);
@@ -530,7 +538,7 @@ static void handleInvite(struct Message *msg) {
 			hash(msg->params[1]), msg->params[1]
 		);
 		logFormat(
-			id, tagTime(msg), "%s invites %s to %s",
+			id, msg, "%s invites %s to %s",
 			msg->nick, msg->params[0], msg->params[1]
 		);
 	}
@@ -633,7 +641,7 @@ static void handleReplyTopic(struct Message *msg) {
 		hash(msg->params[1]), msg->params[1], msg->params[2]
 	);
 	logFormat(
-		id, tagTime(msg), "The sign in %s reads: %s",
+		id, msg, "The sign in %s reads: %s",
 		msg->params[1], msg->params[2]
 	);
 	if (replies[ReplyTopicAuto]) {
@@ -682,7 +690,7 @@ static void handleTopic(struct Message *msg) {
 			hash(msg->user), msg->nick, hash(msg->params[0]), msg->params[0]
 		);
 		logFormat(
-			id, tagTime(msg), "%s removes the sign in %s",
+			id, msg, "%s removes the sign in %s",
 			msg->nick, msg->params[0]
 		);
 		return;
@@ -736,7 +744,7 @@ plain:
 	);
 log:
 	logFormat(
-		id, tagTime(msg), "%s places a new sign in %s: %s",
+		id, msg, "%s places a new sign in %s: %s",
 		msg->nick, msg->params[0], msg->params[1]
 	);
 	topicComplete(id, msg->params[1]);
@@ -876,7 +884,7 @@ static void handleMode(struct Message *msg) {
 				mode, name, hash(msg->params[0]), msg->params[0]
 			);
 			logFormat(
-				id, tagTime(msg), "%s %s %c%s %s%s in %s",
+				id, msg, "%s %s %c%s %s%s in %s",
 				msg->nick, verb, prefix, nick, mode, name, msg->params[0]
 			);
 		}
@@ -895,7 +903,7 @@ static void handleMode(struct Message *msg) {
 					hash(msg->params[0]), msg->params[0]
 				);
 				logFormat(
-					id, tagTime(msg), "%s %s %c%c %s from %s",
+					id, msg, "%s %s %c%c %s from %s",
 					msg->nick, verb, set["-+"], *ch, mask, msg->params[0]
 				);
 			} else {
@@ -908,7 +916,7 @@ static void handleMode(struct Message *msg) {
 					hash(msg->params[0]), msg->params[0], mode, name
 				);
 				logFormat(
-					id, tagTime(msg), "%s %s %s %s the %s %s%s list",
+					id, msg, "%s %s %s %s the %s %s%s list",
 					msg->nick, verb, mask, to, msg->params[0], mode, name
 				);
 			}
@@ -926,7 +934,7 @@ static void handleMode(struct Message *msg) {
 				hash(msg->params[0]), msg->params[0], mode, name, param
 			);
 			logFormat(
-				id, tagTime(msg), "%s %s %s %s%s %s",
+				id, msg, "%s %s %s %s%s %s",
 				msg->nick, verb, msg->params[0], mode, name, param
 			);
 		}
@@ -943,7 +951,7 @@ static void handleMode(struct Message *msg) {
 				hash(msg->params[0]), msg->params[0], mode, name, param
 			);
 			logFormat(
-				id, tagTime(msg), "%s %s %s %s%s %s",
+				id, msg, "%s %s %s %s%s %s",
 				msg->nick, verb, msg->params[0], mode, name, param
 			);
 		} else if (strchr(network.setParamModes, *ch)) {
@@ -954,7 +962,7 @@ static void handleMode(struct Message *msg) {
 				hash(msg->params[0]), msg->params[0], mode, name
 			);
 			logFormat(
-				id, tagTime(msg), "%s %s %s %s%s",
+				id, msg, "%s %s %s %s%s",
 				msg->nick, verb, msg->params[0], mode, name
 			);
 		}
@@ -967,7 +975,7 @@ static void handleMode(struct Message *msg) {
 				hash(msg->params[0]), msg->params[0], mode, name
 			);
 			logFormat(
-				id, tagTime(msg), "%s %s %s %s%s",
+				id, msg, "%s %s %s %s%s",
 				msg->nick, verb, msg->params[0], mode, name
 			);
 		}
@@ -1181,7 +1189,7 @@ static void handleReplyAway(struct Message *msg) {
 		completeColor(id, msg->params[1]), msg->params[1], msg->params[2]
 	);
 	logFormat(
-		id, tagTime(msg), "%s is away: %s",
+		id, msg, "%s is away: %s",
 		msg->params[1], msg->params[2]
 	);
 }
@@ -1302,20 +1310,22 @@ static void handlePrivmsg(struct Message *msg) {
 	}
 	if (notice) {
 		if (id != Network) {
-			logFormat(id, tagTime(msg), "-%s- %s", msg->nick, msg->params[1]);
+			logFormat(id, msg, "-%s- %s", msg->nick, msg->params[1]);
 		}
 		ptr = seprintf(
 			ptr, end, "\3%d-%s-\3%d\t",
 			hash(msg->user), msg->nick, LightGray
 		);
 	} else if (action) {
-		logFormat(id, tagTime(msg), "* %s %s", msg->nick, msg->params[1]);
+		struct Message ctcp = *msg;
+		ctcp.cmd = "ACTION";
+		logFormat(id, &ctcp, "* %s %s", msg->nick, msg->params[1]);
 		ptr = seprintf(
 			ptr, end, "%s\35\3%d* %s\17\35\t",
 			(highlight ? "\26" : ""), hash(msg->user), msg->nick
 		);
 	} else {
-		logFormat(id, tagTime(msg), "<%s> %s", msg->nick, msg->params[1]);
+		logFormat(id, msg, "<%s> %s", msg->nick, msg->params[1]);
 		ptr = seprintf(
 			ptr, end, "%s\3%d<%s>\17\t",
 			(highlight ? "\26" : ""), hash(msg->user), msg->nick
@@ -1379,6 +1389,7 @@ static const struct Handler {
 	{ "368", -ReplyBan, NULL },
 	{ "369", -ReplyWhowas, handleReplyEndOfWhowas },
 	{ "372", 0, handleReplyMOTD },
+	{ "376", 0, handleReplyEndOfMOTD },
 	{ "378", +ReplyWhois, handleReplyWhoisGeneric },
 	{ "379", +ReplyWhois, handleReplyWhoisGeneric },
 	{ "422", 0, handleErrorNoMOTD },
@@ -167,6 +167,11 @@ static size_t cap;
 static char *buf;
 
 void inputUpdate(void) {
+	uiDirty |= DrawInput;
+}
+
+void inputDraw(void) {
+	if (!(uiDirty & DrawInput)) return;
 	uint id = windowID();
 
 	size_t pos = 0;
@@ -390,7 +395,18 @@ fail:
 	return -1;
 }
 
+// Set by C-r and C-s. Edits which follow refine the search until some other
+// key, Enter, or the edit becoming empty ends it.
+static bool searched, searching;
+
+static void searchEnd(void) {
+	if (!searching) return;
+	searching = false;
+	windowSearchEnd();
+}
+
 static void inputEnter(void) {
+	searchEnd();
 	uint id = windowID();
 	char *cmd = editString(&edits[id], &buf, &cap, NULL);
 	if (!cmd) err(1, "editString");
@@ -470,8 +486,14 @@ static void keyCtrl(wchar_t ch) {
 		break; case L'L': clearok(curscr, true); wrefresh(curscr);
 		break; case L'N': windowShow(windowNum() + 1);
 		break; case L'P': windowShow(windowNum() - 1);
-		break; case L'R': windowSearch(editString(edit, &buf, &cap, NULL), -1);
-		break; case L'S': windowSearch(editString(edit, &buf, &cap, NULL), +1);
+		break; case L'R': {
+			windowSearch(editString(edit, &buf, &cap, NULL), -1);
+			searched = true;
+		}
+		break; case L'S': {
+			windowSearch(editString(edit, &buf, &cap, NULL), +1);
+			searched = true;
+		}
 		break; case L'T': error = editFn(edit, EditTranspose);
 		break; case L'U': error = editFn(edit, EditDeleteHead);
 		break; case L'V': windowScroll(ScrollPage, -1);
@@ -519,6 +541,83 @@ static void keyStyle(wchar_t ch) {
 	}
 }
 
+static struct {
+	bool ids[IDCap];
+	bool any;
+} changed;
+
+static uint64_t editSum(const struct Edit *e) {
+	return sum(SumInit, e->buf, e->len * sizeof(*e->buf));
+}
+
+static void inputKey(int ret, wint_t ch) {
+	static bool paste, style, literal;
+	bool tabbing = false;
+	size_t pos = edits[tab.id].pos;
+	bool spr = uiSpoilerReveal;
+	uint id = windowID();
+	struct Edit *edit = &edits[id];
+	size_t len = edit->len;
+	uint64_t before = editSum(edit);
+	searched = false;
+
+	if (ret == KEY_CODE_YES && ch == KeyPasteOn) {
+		paste = true;
+	} else if (ret == KEY_CODE_YES && ch == KeyPasteOff) {
+		paste = false;
+	} else if (ret == KEY_CODE_YES && ch == KeyPasteManual) {
+		paste ^= true;
+	} else if (paste || literal) {
+		int error = editInsert(&edits[windowID()], ch);
+		if (error) err(1, "editInsert");
+	} else if (ret == KEY_CODE_YES) {
+		keyCode(ch);
+	} else if (ch == (L'Z' ^ L'@')) {
+		style = true;
+		return;
+	} else if (style && ch == (L'V' ^ L'@')) {
+		literal = true;
+		return;
+	} else if (style) {
+		keyStyle(ch);
+	} else if (iswcntrl(ch)) {
+		tabbing = (ch == (L'I' ^ L'@'));
+		keyCtrl(ch);
+	} else {
+		int error = editInsert(&edits[windowID()], ch);
+		if (error) err(1, "editInsert");
+	}
+	style = false;
+	literal = false;
+
+	// Edits following C-r or C-s refine the search as it is typed.
+	bool edited = (edit == &edits[windowID()] && edit->len != len);
+	if (searched) {
+		searching = true;
+	} else if (searching && edited && edit->len) {
+		windowSearch(editString(edit, &buf, &cap, NULL), 0);
+	} else {
+		searchEnd();
+	}
+	if (editSum(edit) != before) {
+		changed.ids[id] = true;
+		changed.any = true;
+	}
+
+	if (!tabbing) {
+		if (edits[tab.id].pos > pos) {
+			tabAccept();
+		} else if (edits[tab.id].pos < pos) {
+			tabReject();
+		}
+	}
+
+	if (spr) {
+		uiSpoilerReveal = false;
+		windowUpdate();
+	}
+}
+
 static bool waiting;
 
 void inputWait(void) {
@@ -537,53 +636,8 @@ void inputRead(void) {
 	}
 
 	wint_t ch;
-	static bool paste, style, literal;
 	for (int ret; ERR != (ret = wget_wch(uiInput, &ch));) {
-		bool tabbing = false;
-		size_t pos = edits[tab.id].pos;
-		bool spr = uiSpoilerReveal;
-
-		if (ret == KEY_CODE_YES && ch == KeyPasteOn) {
-			paste = true;
-		} else if (ret == KEY_CODE_YES && ch == KeyPasteOff) {
-			paste = false;
-		} else if (ret == KEY_CODE_YES && ch == KeyPasteManual) {
-			paste ^= true;
-		} else if (paste || literal) {
-			int error = editInsert(&edits[windowID()], ch);
-			if (error) err(1, "editInsert");
-		} else if (ret == KEY_CODE_YES) {
-			keyCode(ch);
-		} else if (ch == (L'Z' ^ L'@')) {
-			style = true;
-			continue;
-		} else if (style && ch == (L'V' ^ L'@')) {
-			literal = true;
-			continue;
-		} else if (style) {
-			keyStyle(ch);
-		} else if (iswcntrl(ch)) {
-			tabbing = (ch == (L'I' ^ L'@'));
-			keyCtrl(ch);
-		} else {
-			int error = editInsert(&edits[windowID()], ch);
-			if (error) err(1, "editInsert");
-		}
-		style = false;
-		literal = false;
-
-		if (!tabbing) {
-			if (edits[tab.id].pos > pos) {
-				tabAccept();
-			} else if (edits[tab.id].pos < pos) {
-				tabReject();
-			}
-		}
-
-		if (spr) {
-			uiSpoilerReveal = false;
-			windowUpdate();
-		}
+		inputKey(ret, ch);
 	}
 	inputUpdate();
 }
@@ -606,6 +660,29 @@ int inputSave(FILE *file) {
 	return writeString(file, "");
 }
 
+bool inputChanged(void) {
+	return changed.any;
+}
+
+// Unlike the save file, a journal batch holds cleared edits as empty strings
+// so that replaying it clears them too.
+int inputJournal(FILE *file) {
+	int error;
+	for (uint id = 0; id < IDCap; ++id) {
+		if (!changed.ids[id]) continue;
+		char *ptr = "";
+		if (edits[id].len) ptr = editString(&edits[id], &buf, &cap, NULL);
+		if (!ptr) return -1;
+		error = 0
+			|| writeString(file, idNames[id])
+			|| writeString(file, ptr);
+		if (error) return error;
+		changed.ids[id] = false;
+	}
+	changed.any = false;
+	return writeString(file, "");
+}
+
 static ssize_t readString(FILE *file, char **buf, size_t *cap) {
 	ssize_t len = getdelim(buf, cap, '\0', file);
 	if (len < 0 && !feof(file)) err(1, "getdelim");
@@ -626,3 +703,156 @@ void inputLoad(FILE *file, size_t version) {
 		edits[id].pos = len;
 	}
 }
+
+#ifdef TEST
+#undef NDEBUG
+
+char *idNames[IDCap];
+enum Color idColors[IDCap];
+uint idNext;
+struct Self self;
+struct Time windowTime;
+struct _win_st *uiInput;
+bool uiSpoilerReveal;
+uint uiDirty;
+
+static char *searchStr;
+static char *sent;
+
+void windowSearch(const char *str, int dir) {
+	(void)dir;
+	free(searchStr);
+	searchStr = (str[0] ? strdup(str) : NULL);
+}
+void windowSearchEnd(void) {
+	free(searchStr);
+	searchStr = NULL;
+}
+void command(uint id, char *input) {
+	(void)id;
+	free(sent);
+	sent = strdup(input);
+}
+
+uint windowID(void) { return Network; }
+uint windowNum(void) { return 0; }
+void windowShow(uint num) { (void)num; }
+void windowAuto(void) {}
+void windowSwap(void) {}
+void windowBare(void) {}
+void windowMark(void) {}
+void windowUnmark(void) {}
+void windowUpdate(void) {}
+void windowToggleMute(void) {}
+void windowToggleTime(void) {}
+void windowToggleThresh(int n) { (void)n; }
+bool windowTimeEnable(void) { return false; }
+void windowScroll(enum Scroll by, int n) { (void)by; (void)n; }
+const char *commandIsPrivmsg(uint id, const char *input) {
+	(void)id;
+	return input;
+}
+const char *commandIsNotice(uint id, const char *input) {
+	(void)id;
+	(void)input;
+	return NULL;
+}
+const char *commandIsAction(uint id, const char *input) {
+	(void)id;
+	(void)input;
+	return NULL;
+}
+size_t commandWillSplit(uint id, const char *input) {
+	(void)id;
+	(void)input;
+	return 0;
+}
+void completePush(uint id, const char *str, enum Color color) {
+	(void)id;
+	(void)str;
+	(void)color;
+}
+const char *completePrefix(struct Cursor *curs, uint id, const char *prefix) {
+	(void)curs;
+	(void)id;
+	(void)prefix;
+	return NULL;
+}
+void completeAccept(struct Cursor *curs) { (void)curs; }
+void completeReject(struct Cursor *curs) { (void)curs; }
+uint uiAttr(struct Style style) {
+	(void)style;
+	return 0;
+}
+short uiPair(struct Style style) {
+	(void)style;
+	return 0;
+}
+void uiShow(void) {}
+void uiResize(void) {}
+void uiWrite(uint id, enum Heat heat, const time_t *time, const char *str) {
+	(void)id;
+	(void)heat;
+	(void)time;
+	(void)str;
+}
+
+static void type(const char *str) {
+	for (; *str; ++str) inputKey(OK, *str);
+}
+
+int main(void) {
+	for (size_t i = 0; i < ARRAY_LEN(edits); ++i) {
+		edits[i].cut = &cut;
+	}
+
+	type("foo");
+	inputKey(OK, L'R' ^ L'@');
+	assert(searchStr && !strcmp(searchStr, "foo"));
+	type("d");
+	assert(searchStr && !strcmp(searchStr, "food"));
+
+	// Enter sends the search text and ends the search.
+	inputKey(OK, L'J' ^ L'@');
+	assert(sent && !strcmp(sent, "food"));
+	assert(!searchStr);
+	type("hi");
+	assert(!searchStr);
+	inputKey(KEY_CODE_YES, KEY_ENTER);
+	assert(!strcmp(sent, "hi"));
+
+	// Emptying the edit ends the search, too.
+	inputKey(OK, L'S' ^ L'@');
+	type("x");
+	assert(searchStr && !strcmp(searchStr, "x"));
+	inputKey(OK, L'H' ^ L'@');
+	assert(!searchStr);
+	type("y");
+	assert(!searchStr);
+
+	// Other keys end it.
+	inputKey(OK, L'R' ^ L'@');
+	assert(searchStr && !strcmp(searchStr, "y"));
+	inputKey(OK, L'A' ^ L'@');
+	type("z");
+	assert(!searchStr);
+
+	// Journal batches hold changed edits, even when they were cleared.
+	idNames[Network] = "network";
+	char *ptr = NULL;
+	size_t len = 0;
+	FILE *file = open_memstream(&ptr, &len);
+	assert(file && inputChanged() && !inputJournal(file));
+	assert(!inputChanged());
+	inputKey(KEY_CODE_YES, KEY_LEFT);
+	assert(!inputChanged());
+	inputKey(OK, L'J' ^ L'@');
+	assert(inputChanged() && !inputJournal(file));
+	assert(!inputJournal(file));
+	fclose(file);
+	assert(len == sizeof("network\0zy\0\0network\0\0\0"));
+	assert(!memcmp(ptr, "network\0zy\0\0network\0\0\0", len));
+	free(ptr);
+}
+
+#endif /* TEST */
@@ -26,14 +26,23 @@
  */
 
 #include <assert.h>
+#include <ctype.h>
+#include <dirent.h>
 #include <err.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -43,6 +52,293 @@
 
 #include "chat.h"
 
+// Lines are formatted on the main thread into a ring of records, which a
+// writer thread empties with writev(2), so that a slow disk never stalls
+// the interface. With one producer and one consumer, the ring needs no
+// lock, only the ordering of its head and tail. A line that doesn't fit
+// is dropped rather than waited for.
+enum { QueueCap = 256 * 1024, QueueBatch = 64 * 1024, IOVCap = 64 };
+
+// Index records are marked so the writer can cut off a block torn by a
+// crash before appending to the file.
+struct Record {
+	uint64_t time;
+	int fd;
+	uint32_t len : 31;
+	uint32_t index : 1;
+};
+
+static struct {
+	_Alignas(struct Record) byte buf[QueueCap];
+	atomic_size_t head;
+	atomic_size_t tail;
+	atomic_bool wake;
+	atomic_bool done;
+	atomic_int error;
+	int pipe[2];
+	pthread_t thread;
+} queue;
+
+static size_t depthMax;
+static size_t dropped;
+static atomic_size_t written;
+static atomic_size_t batches;
+static atomic_uint_least64_t latency;
+static atomic_uint_least64_t latencyMax;
+static atomic_size_t closing;
+
+uint logInterval = 250;
+bool logSync;
+bool logPack;
+bool logJSON;
+bool logBacklog;
+
+static uint64_t nsec(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Records start on a multiple of their size, so there is always room for
+// one to mark the unused end of the ring.
+static size_t recordSize(size_t len) {
+	return sizeof(struct Record) + ((len + sizeof(struct Record)) & ~15);
+}
+_Static_assert(sizeof(struct Record) == 16, "Record is 16 bytes");
+
+static int writeAll(int fd, struct iovec *iov, int n) {
+	while (n) {
+		ssize_t len = writev(fd, iov, n);
+		if (len < 0 && errno == EINTR) continue;
+		if (len < 0) return -1;
+		for (; n && (size_t)len >= iov->iov_len; ++iov, --n) {
+			len -= iov->iov_len;
+		}
+		if (!n) break;
+		iov->iov_base = (char *)iov->iov_base + len;
+		iov->iov_len -= len;
+	}
+	return (logSync ? fsync(fd) : 0);
+}
+
+// Lines are written to each file in one go, in the order they were queued.
+static struct Pending {
+	int fd;
+	uint32_t len;
+	bool index;
+	uint64_t time;
+	size_t seq;
+	const void *ptr;
+} pending[QueueCap / sizeof(struct Record) / 2];
+
+static int pendingCmp(const void *_a, const void *_b) {
+	const struct Pending *a = _a, *b = _b;
+	if (a->fd != b->fd) return (a->fd < b->fd ? -1 : +1);
+	return (a->seq < b->seq ? -1 : +1);
+}
+
+// Each directory of logs has an index of blocks of whole lines, each with
+// the set of trigram hashes in its lines, ignoring case. Blocks are added
+// as lines are logged and when searching finds a region of the logs with
+// no blocks, such as those cut short by a crash or older than the index.
+enum { IndexBlock = 8 * 1024, IndexGrams = 4096 };
+enum { IndexMagic = 0x7867696C };
+
+struct Index {
+	uint32_t magic;
+	uint32_t date;
+	uint32_t offset;
+	uint32_t len;
+	uint64_t grams[IndexGrams / 64];
+};
+
+// Only the writer appends to an index, and every block queued for it before
+// has been written by the time its file is, so it is safe to cut here.
+static int indexRepair(int fd) {
+	struct stat st;
+	int error = fstat(fd, &st);
+	if (error) return error;
+	off_t len = sizeof(struct Index);
+	if (!(st.st_size % len)) return 0;
+	return ftruncate(fd, st.st_size - st.st_size % len);
+}
+
+static int logFlush(size_t n) {
+	qsort(pending, n, sizeof(*pending), pendingCmp);
+	struct iovec iov[IOVCap];
+	for (size_t i = 0; i < n;) {
+		size_t j = i;
+		int len = 0;
+		for (; j < n && len < IOVCap && pending[j].fd == pending[i].fd; ++j) {
+			iov[len].iov_base = (void *)pending[j].ptr;
+			iov[len++].iov_len = pending[j].len;
+		}
+		int error = 0;
+		if (pending[i].index) error = indexRepair(pending[i].fd);
+		if (error) return error;
+		error = writeAll(pending[i].fd, iov, len);
+		if (error) return error;
+		uint64_t now = nsec();
+		for (; i < j; ++i) {
+			uint64_t wait = now - pending[i].time;
+			atomic_fetch_add(&latency, wait);
+			if (wait > atomic_load(&latencyMax)) {
+				atomic_store(&latencyMax, wait);
+			}
+		}
+		atomic_fetch_add(&written, len);
+		atomic_fetch_add(&batches, 1);
+	}
+	return 0;
+}
+
+// A file is closed only once the lines queued before are written, and its
+// descriptor may be reused after, so lines are flushed at each close.
+static int logDrain(size_t tail, size_t head) {
+	size_t n = 0;
+	while (tail < head) {
+		const struct Record *record = (void *)&queue.buf[tail % QueueCap];
+		if (record->fd < 0) {
+			tail += sizeof(*record) + record->len;
+			continue;
+		}
+		tail += recordSize(record->len);
+		if (record->len) {
+			pending[n] = (struct Pending) {
+				record->fd, record->len, record->index, record->time, n,
+				&record[1]
+			};
+			n++;
+			continue;
+		}
+		int error = logFlush(n);
+		if (error) return error;
+		n = 0;
+		close(record->fd);
+		atomic_fetch_sub(&closing, 1);
+	}
+	return logFlush(n);
+}
+
+static void *logWriter(void *arg) {
+	(void)arg;
+	for (;;) {
+		atomic_store(&queue.wake, false);
+		bool done = atomic_load(&queue.done);
+		size_t tail = atomic_load(&queue.tail);
+		size_t head = atomic_load(&queue.head);
+		if (!done) {
+			// Wait to be woken while the ring is empty, otherwise for more
+			// lines to batch up until the interval passes or enough have.
+			struct pollfd pfd = { .fd = queue.pipe[0], .events = POLLIN };
+			int nfds = poll(&pfd, 1, (head == tail ? -1 : (int)logInterval));
+			if (nfds > 0) {
+				char buf[64];
+				while (0 < read(queue.pipe[0], buf, sizeof(buf)));
+			}
+			if (head == tail) continue;
+			head = atomic_load(&queue.head);
+		}
+		int error = logDrain(tail, head);
+		if (error) {
+			atomic_store(&queue.error, errno);
+			return NULL;
+		}
+		atomic_store(&queue.tail, head);
+		if (done) return NULL;
+	}
+}
+
+static void logWake(void) {
+	if (atomic_exchange(&queue.wake, true)) return;
+	ssize_t len = write(queue.pipe[1], "", 1);
+	(void)len;
+}
+
+static byte fold[256];
+
+static uint indexGram(const char *ptr) {
+	uint32_t gram = (uint32_t)fold[(byte)ptr[0]] << 16
+		| (uint32_t)fold[(byte)ptr[1]] << 8
+		| (uint32_t)fold[(byte)ptr[2]];
+	return (uint32_t)(gram * UINT32_C(0x9E3779B1)) >> 20;
+}
+_Static_assert(IndexGrams == 1 << (32 - 20), "indexGram fills IndexGrams");
+
+static void indexGrams(struct Index *block, const char *ptr, size_t len) {
+	for (size_t i = 0; i + 3 <= len; ++i) {
+		uint gram = indexGram(&ptr[i]);
+		block->grams[gram / 64] |= 1ull << (gram % 64);
+	}
+}
+
+// Completed days may be packed into chunks compressed independently, so any
+// part of one can be read without the rest. The header is followed by the
+// unpacked and packed offsets of each chunk, then one more for the ends.
+// A day is read as its packed file followed by any lines logged after.
+enum { PackChunk = 64 * 1024, PackMagic = 0x6B63706C };
+
+struct Pack {
+	uint32_t magic;
+	uint32_t len;
+	uint64_t size;
+};
+
+struct Chunk {
+	uint64_t raw;
+	uint64_t packed;
+};
+
+static void dayName(char *buf, size_t cap, uint32_t date, const char *ext) {
+	snprintf(
+		buf, cap, "%04u-%02u-%02u%s",
+		date / 10000 % 10000, date / 100 % 100, date % 100, ext
+	);
+}
+
+static const struct Pack *packCheck(const void *ptr, size_t size) {
+	const struct Pack *pack = ptr;
+	if (size < sizeof(*pack) || pack->magic != PackMagic) return NULL;
+	const struct Chunk *chunks = (const void *)&pack[1];
+	if ((size - sizeof(*pack)) / sizeof(*chunks) <= pack->len) return NULL;
+	uint64_t start = sizeof(*pack) + sizeof(*chunks) * (pack->len + 1);
+	if (chunks[0].raw || chunks[0].packed != start) return NULL;
+	for (uint32_t i = 0; i < pack->len; ++i) {
+		if (chunks[i + 1].raw < chunks[i].raw) return NULL;
+		if (chunks[i + 1].packed < chunks[i].packed) return NULL;
+	}
+	if (chunks[pack->len].raw != pack->size) return NULL;
+	if (chunks[pack->len].packed > size) return NULL;
+	return pack;
+}
+
+static uint32_t logDate(const struct tm *tm) {
+	return (tm->tm_year + 1900) * 10000 + (tm->tm_mon + 1) * 100 + tm->tm_mday;
+}
+
+// Files are kept open for the most recently logged IDs, along with their
+// indexes, as many as leave room under the descriptor limit, including for
+// files the writer has yet to close. Directories are only made once per ID. Each ID also tracks the
+// length of its file for the block being indexed, and where in the file
+// logging began, since lines before it are not indexed by logFormat().
+enum { FileReserve = 64 };
+static size_t fileCap = IDCap;
+static size_t fileLen;
+static uint64_t fileTick;
+static size_t hits, misses, evictions;
+static char *fileNetwork;
+
+static struct {
+	uint32_t date;
+	int fd;
+	int index;
+	uint64_t used;
+	bool dir;
+	uint32_t since;
+	uint32_t end;
+	struct Index block;
+} logs[IDCap];
+
 static int logDir = -1;
 
 void logOpen(void) {
@@ -59,12 +355,50 @@ void logOpen(void) {
 #ifdef __FreeBSD__
 	cap_rights_t rights;
 	cap_rights_init(
-		&rights, CAP_MKDIRAT, CAP_CREATE, CAP_WRITE,
-		/* for fdopen(3) */ CAP_FCNTL, CAP_FSTAT
+		&rights, CAP_MKDIRAT, CAP_CREATE, CAP_WRITE, CAP_FSYNC,
+		CAP_READ, CAP_FSTAT, CAP_FCNTL, CAP_FTRUNCATE, CAP_MMAP_R,
+		CAP_SEEK, CAP_FSTATAT, CAP_UNLINKAT,
+		CAP_RENAMEAT_SOURCE, CAP_RENAMEAT_TARGET
 	);
 	error = caph_rights_limit(logDir, &rights);
 	if (error) err(1, "cap_rights_limit");
 #endif
+
+	error = pipe(queue.pipe);
+	if (error) err(1, "pipe");
+	fcntl(queue.pipe[0], F_SETFD, FD_CLOEXEC);
+	fcntl(queue.pipe[1], F_SETFD, FD_CLOEXEC);
+	fcntl(queue.pipe[0], F_SETFL, O_NONBLOCK);
+	fcntl(queue.pipe[1], F_SETFL, O_NONBLOCK);
+
+	for (uint id = 0; id < IDCap; ++id) {
+		logs[id].fd = -1;
+		logs[id].index = -1;
+	}
+	for (uint ch = 0; ch < ARRAY_LEN(fold); ++ch) {
+		fold[ch] = tolower(ch);
+	}
+	struct rlimit limit;
+	error = getrlimit(RLIMIT_NOFILE, &limit);
+	if (error) err(1, "getrlimit");
+	if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < 3 * IDCap) {
+		fileCap = 1;
+		if (limit.rlim_cur > FileReserve + 3) {
+			fileCap = (limit.rlim_cur - FileReserve) / 3;
+		}
+	}
+
+	// Leave signals to the main thread.
+	sigset_t mask, prev;
+	sigfillset(&mask);
+	pthread_sigmask(SIG_SETMASK, &mask, &prev);
+	error = pthread_create(&queue.thread, NULL, logWriter, NULL);
+	pthread_sigmask(SIG_SETMASK, &prev, NULL);
+	if (error) {
+		errno = error;
+		err(1, "pthread_create");
+	}
+	atexit(logClose);
 }
 
 static void logMkdir(const char *path) {
@@ -81,41 +415,185 @@ static void sanitize(char *ptr, char *end) {
 	}
 }
 
-static struct {
-	int year;
-	int month;
-	int day;
-	FILE *file;
-} logs[IDCap];
+static struct Record *logReserve(size_t len, size_t *size) {
+	size_t head = atomic_load(&queue.head);
+	size_t tail = atomic_load(&queue.tail);
+	size_t pos = head % QueueCap;
+	*size = recordSize(len);
+	size_t pad = (pos + *size > QueueCap ? QueueCap - pos : 0);
+	if (head + pad + *size - tail > QueueCap) return NULL;
+	if (pad) {
+		struct Record *skip = (struct Record *)&queue.buf[pos];
+		skip->fd = -1;
+		skip->len = pad - sizeof(*skip);
+		*size += pad;
+	}
+	return (struct Record *)&queue.buf[(head + pad) % QueueCap];
+}
+
+static void logCommit(size_t size) {
+	size_t head = atomic_load(&queue.head);
+	size_t tail = atomic_load(&queue.tail);
+	atomic_store(&queue.head, head + size);
+	size_t depth = head + size - tail;
+	if (depth > depthMax) depthMax = depth;
+	if (head == tail || depth >= QueueBatch) logWake();
+}
 
-static FILE *logFile(uint id, const struct tm *tm) {
-	if (
-		logs[id].file &&
-		logs[id].year == tm->tm_year &&
-		logs[id].month == tm->tm_mon &&
-		logs[id].day == tm->tm_mday
-	) return logs[id].file;
+static void logCheck(void) {
+	int error = atomic_load(&queue.error);
+	if (!error) return;
+	errno = error;
+	err(1, "log");
+}
 
-	if (logs[id].file) {
-		int error = fclose(logs[id].file);
-		if (error) err(1, "%s", idNames[id]);
+static struct Record *logWait(size_t len, size_t *size) {
+	struct Record *record;
+	while (!(record = logReserve(len, size))) {
+		logCheck();
+		logWake();
+		nanosleep(&(struct timespec) { .tv_nsec = 100000 }, NULL);
 	}
+	return record;
+}
 
-	logs[id].year = tm->tm_year;
-	logs[id].month = tm->tm_mon;
-	logs[id].day = tm->tm_mday;
+// Only in a pathological case will the writer not have caught up.
+static void logThrottle(void) {
+	while (atomic_load(&closing) >= fileCap) {
+		logCheck();
+		logWake();
+		nanosleep(&(struct timespec) { .tv_nsec = 100000 }, NULL);
+	}
+}
 
-	char path[PATH_MAX];
-	char *ptr = path, *end = &path[sizeof(path)];
+// Wait for the writer to empty the ring.
+static void logSettle(void) {
+	while (atomic_load(&queue.tail) != atomic_load(&queue.head)) {
+		logCheck();
+		logWake();
+		nanosleep(&(struct timespec) { .tv_nsec = 100000 }, NULL);
+	}
+}
 
-	ptr = seprintf(ptr, end, "%s", network.name);
-	sanitize(path, ptr);
-	logMkdir(path);
+// Closing a file waits its turn behind the lines written to it.
+static void logRelease(int fd) {
+	size_t size;
+	struct Record *record = logWait(0, &size);
+	record->time = nsec();
+	record->fd = fd;
+	record->len = 0;
+	record->index = false;
+	atomic_fetch_add(&closing, 1);
+	logCommit(size);
+}
 
+static char *logPath(char *ptr, char *end, const char *net, uint id) {
 	char *name = ptr;
+	ptr = seprintf(ptr, end, "%s", net);
+	sanitize(name, ptr);
+	name = ptr;
 	ptr = seprintf(ptr, end, "/%s", idNames[id]);
 	sanitize(&name[1], ptr);
-	logMkdir(path);
+	return ptr;
+}
+
+// Blocks are appended by the writer, after cutting off any torn by a crash.
+static void indexQueue(int fd, const struct Index *block) {
+	size_t size;
+	struct Record *record = logWait(sizeof(*block), &size);
+	memcpy(&record[1], block, sizeof(*block));
+	record->time = nsec();
+	record->fd = fd;
+	record->len = sizeof(*block);
+	record->index = true;
+	logCommit(size);
+}
+
+static int indexOpen(const char *dir) {
+	char path[PATH_MAX];
+	snprintf(path, sizeof(path), "%s/index", dir);
+	logThrottle();
+	int fd = openat(
+		logDir, path,
+		O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+		S_IRUSR | S_IWUSR
+	);
+	if (fd < 0) err(1, "log/%s", path);
+	return fd;
+}
+
+static void indexWrite(const char *dir, const struct Index *block) {
+	int fd = indexOpen(dir);
+	indexQueue(fd, block);
+	logRelease(fd);
+}
+
+// The index of an ID is kept open alongside its log file.
+static void indexFlush(uint id) {
+	if (!logs[id].block.len) return;
+	if (logs[id].index < 0) {
+		char path[PATH_MAX];
+		logPath(path, &path[sizeof(path)], fileNetwork, id);
+		logs[id].index = indexOpen(path);
+	}
+	indexQueue(logs[id].index, &logs[id].block);
+	logs[id].block.len = 0;
+}
+
+static void indexClose(uint id) {
+	if (logs[id].index < 0) return;
+	logRelease(logs[id].index);
+	logs[id].index = -1;
+}
+
+static void indexLine(uint id, const char *ptr, size_t len) {
+	struct Index *block = &logs[id].block;
+	if (!block->len) {
+		memset(block, 0, sizeof(*block));
+		block->magic = IndexMagic;
+		block->date = logs[id].date;
+		block->offset = logs[id].end;
+	}
+	indexGrams(block, ptr, len - 1);
+	block->len += len;
+	logs[id].end += len;
+}
+
+static void logEvict(void) {
+	uint lru = None;
+	for (uint id = 0; id < IDCap; ++id) {
+		if (logs[id].fd < 0) continue;
+		if (logs[lru].fd < 0 || logs[id].used < logs[lru].used) lru = id;
+	}
+	indexFlush(lru);
+	indexClose(lru);
+	logRelease(logs[lru].fd);
+	logs[lru].fd = -1;
+	fileLen--;
+	evictions++;
+}
+
+// Return -1 if the directories made before have since been removed.
+static int logFileOpen(uint id, const struct tm *tm, bool retry) {
+	char path[PATH_MAX];
+	char *end = &path[sizeof(path)];
+	char *ptr = logPath(path, end, network.name, id);
+
+	if (!fileNetwork || strcmp(fileNetwork, network.name)) {
+		char *slash = strchr(path, '/');
+		*slash = '\0';
+		logMkdir(path);
+		*slash = '/';
+		free(fileNetwork);
+		fileNetwork = strdup(network.name);
+		if (!fileNetwork) err(1, "strdup");
+		for (uint i = 0; i < IDCap; ++i) {
+			logs[i].dir = false;
+		}
+	}
+
+	if (!logs[id].dir) logMkdir(path);
+	logs[id].dir = true;
 
 	size_t len = strftime(ptr, end - ptr, "/%F.log", tm);
 	if (!len) errx(1, "log path too long");
@@ -125,44 +603,1263 @@ static FILE *logFile(uint id, const struct tm *tm) {
 		O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
 		S_IRUSR | S_IWUSR
 	);
-	if (fd < 0) err(1, "log/%s", path);
-	logs[id].file = fdopen(fd, "a");
-	if (!logs[id].file) err(1, "fdopen");
+	if (fd < 0 && (errno != ENOENT || !retry)) err(1, "log/%s", path);
+	return fd;
+}
 
-	setlinebuf(logs[id].file);
-	return logs[id].file;
+// Lines logged to a day after it was packed follow those packed.
+static size_t logPacked(uint id, const struct tm *tm) {
+	char path[PATH_MAX];
+	char *end = &path[sizeof(path)];
+	char *ptr = logPath(path, end, network.name, id);
+	size_t len = strftime(ptr, end - ptr, "/%F.log.lz", tm);
+	if (!len) errx(1, "log path too long");
+	int fd = openat(logDir, path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 && errno == ENOENT) return 0;
+	if (fd < 0) err(1, "log/%s", path);
+	struct Pack pack;
+	ssize_t n = pread(fd, &pack, sizeof(pack), 0);
+	close(fd);
+	return (n == sizeof(pack) && pack.magic == PackMagic ? pack.size : 0);
 }
 
-void logClose(void) {
-	if (logDir < 0) return;
+// Files follow the network name once it is known after connecting.
+static void logMove(void) {
 	for (uint id = 0; id < IDCap; ++id) {
-		if (!logs[id].file) continue;
-		int error = fclose(logs[id].file);
-		if (error) err(1, "%s", idNames[id]);
+		indexFlush(id);
+		indexClose(id);
+		logs[id].date = 0;
+		if (logs[id].fd < 0) continue;
+		logRelease(logs[id].fd);
+		logs[id].fd = -1;
+		fileLen--;
 	}
-	close(logDir);
 }
 
-void logFormat(uint id, const time_t *src, const char *format, ...) {
-	if (logDir < 0) return;
+static int logFile(uint id, const struct tm *tm) {
+	if (fileNetwork && strcmp(fileNetwork, network.name)) logMove();
+	uint32_t date = logDate(tm);
+	logs[id].used = ++fileTick;
+	if (logs[id].fd >= 0 && logs[id].date == date) {
+		hits++;
+		return logs[id].fd;
+	}
+	misses++;
 
-	time_t ts = (src ? *src : time(NULL));
-	struct tm *tm = localtime(&ts);
-	if (!tm) err(1, "localtime");
+	if (logs[id].fd >= 0) {
+		logRelease(logs[id].fd);
+		fileLen--;
+	} else if (fileLen == fileCap) {
+		logEvict();
+	}
+	logThrottle();
 
-	FILE *file = logFile(id, tm);
+	logs[id].fd = logFileOpen(id, tm, true);
+	if (logs[id].fd < 0) {
+		indexClose(id);
+		free(fileNetwork);
+		fileNetwork = NULL;
+		logs[id].fd = logFileOpen(id, tm, false);
+	}
+	fileLen++;
 
-	char buf[sizeof("0000-00-00T00:00:00+0000")];
-	strftime(buf, sizeof(buf), "%FT%T%z", tm);
-	int n = fprintf(file, "[%s] ", buf);
-	if (n < 0) err(1, "%s", idNames[id]);
+	if (logs[id].date != date) {
+		indexFlush(id);
+		struct stat st;
+		int error = fstat(logs[id].fd, &st);
+		if (error) err(1, "fstat");
+		logs[id].date = date;
+		logs[id].since = st.st_size + logPacked(id, tm);
+		logs[id].end = logs[id].since;
+	}
+	return logs[id].fd;
+}
+
+// Structured lines are JSON objects in place of the text, with the fields
+// of the message logged and its time to the millisecond, then the text.
+static const char JSONText[] = ",\"text\":\"";
+
+static size_t jsonRaw(char *buf, size_t len, const char *str) {
+	size_t n = strlen(str);
+	if (buf) memcpy(&buf[len], str, n);
+	return len + n;
+}
+
+static size_t jsonString(char *buf, size_t len, const char *str) {
+	static const char Hex[] = "0123456789abcdef";
+	char esc[7];
+	len = jsonRaw(buf, len, "\"");
+	for (const char *ch = str; *ch; ++ch) {
+		byte b = *ch;
+		if (b == '"' || b == '\\') {
+			len = jsonRaw(buf, len, (b == '"' ? "\\\"" : "\\\\"));
+		} else if (b < ' ') {
+			snprintf(esc, sizeof(esc), "\\u00%c%c", Hex[b >> 4], Hex[b & 15]);
+			len = jsonRaw(buf, len, esc);
+		} else {
+			if (buf) buf[len] = b;
+			len++;
+		}
+	}
+	return jsonRaw(buf, len, "\"");
+}
+
+static size_t jsonField(
+	char *buf, size_t len, const char *key, const char *value
+) {
+	if (!value) return len;
+	len = jsonRaw(buf, len, ",\"");
+	len = jsonRaw(buf, len, key);
+	len = jsonRaw(buf, len, "\":");
+	return jsonString(buf, len, value);
+}
+
+// Return the length of the line, writing it to buf if not null.
+static size_t jsonLine(
+	char *buf, const struct Message *msg, const char *time, const char *text
+) {
+	size_t len = jsonRaw(buf, 0, "{\"time\":");
+	len = jsonString(buf, len, time);
+	if (msg) {
+		len = jsonField(buf, len, "type", msg->cmd);
+		len = jsonField(buf, len, "msgid", msg->tags[TagMsgID]);
+		len = jsonField(buf, len, "account", msg->tags[TagAccount]);
+		len = jsonField(buf, len, "nick", msg->nick);
+		len = jsonField(buf, len, "user", msg->user);
+		len = jsonField(buf, len, "host", msg->host);
+		len = jsonRaw(buf, len, ",\"params\":[");
+		for (uint i = 0; i < ParamCap && msg->params[i]; ++i) {
+			if (i) len = jsonRaw(buf, len, ",");
+			len = jsonString(buf, len, msg->params[i]);
+		}
+		len = jsonRaw(buf, len, "]");
+	}
+	len = jsonRaw(buf, len, ",\"text\":");
+	len = jsonString(buf, len, text);
+	return jsonRaw(buf, len, "}\n");
+}
+
+// Messages are logged at the server time if it sent one, otherwise now.
+static time_t logTime(const struct Message *msg, char *buf, size_t cap) {
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	time_t time = now.tv_sec;
+	int ms = now.tv_nsec / 1000000;
+
+	struct tm tm = {0};
+	const char *tag = (msg ? msg->tags[TagTime] : NULL);
+	const char *rest = (tag ? strptime(tag, "%Y-%m-%dT%T", &tm) : NULL);
+	if (rest) {
+		time = timegm(&tm);
+		ms = 0;
+		if (rest[0] == '.') {
+			for (int i = 1, scale = 100; scale && isdigit((byte)rest[i]); ++i) {
+				ms += (rest[i] - '0') * scale;
+				scale /= 10;
+			}
+		}
+	}
+	if (!gmtime_r(&time, &tm)) tm = (struct tm) {0};
+	size_t len = strftime(buf, cap, "%FT%T", &tm);
+	snprintf(&buf[len], cap - len, ".%03dZ", ms);
+	return time;
+}
+
+void logFormat(uint id, const struct Message *msg, const char *format, ...) {
+	if (logDir < 0) return;
+	logCheck();
+
+	char utc[64];
+	time_t ts = logTime(msg, utc, sizeof(utc));
+	int fd = logFile(id, stampLocal(ts));
 
 	va_list ap;
 	va_start(ap, format);
-	n = vfprintf(file, format, ap);
+	int n = vsnprintf(NULL, 0, format, ap);
 	va_end(ap);
 	if (n < 0) err(1, "%s", idNames[id]);
 
-	n = fprintf(file, "\n");
-	if (n < 0) err(1, "%s", idNames[id]);
+	static struct Stamp stamp;
+	static char *text;
+	static size_t textCap;
+	const char *str = NULL;
+	size_t size, len;
+	if (logJSON) {
+		if ((size_t)n >= textCap) {
+			textCap = n + 1;
+			text = realloc(text, textCap);
+			if (!text) err(1, "realloc");
+		}
+		va_start(ap, format);
+		vsnprintf(text, n + 1, format, ap);
+		va_end(ap);
+		len = jsonLine(NULL, msg, utc, text);
+	} else {
+		str = stampFormat(&stamp, "%FT%T%z", ts);
+		len = strlen(str) + n + 4;
+	}
+
+	if (logs[id].block.len + len > IndexBlock) indexFlush(id);
+	struct Record *record = logReserve(len, &size);
+	if (!record) {
+		dropped++;
+		return;
+	}
+	char *ptr = (char *)&record[1];
+	if (logJSON) {
+		jsonLine(ptr, msg, utc, text);
+	} else {
+		int prefix = snprintf(ptr, len + 1, "[%s] ", str);
+		va_start(ap, format);
+		vsnprintf(&ptr[prefix], len + 1 - prefix, format, ap);
+		va_end(ap);
+		ptr[len - 1] = '\n';
+	}
+	indexLine(id, ptr, len);
+
+	record->time = nsec();
+	record->fd = fd;
+	record->len = len;
+	record->index = false;
+	logCommit(size);
+}
+
+// Return false if the line is not structured, otherwise unescape its text
+// into buf and parse its time.
+static bool jsonText(
+	const char *ptr, size_t len, char *buf, size_t cap, time_t *time
+) {
+	static const char Time[] = "{\"time\":\"";
+	if (len < sizeof(Time) || memcmp(ptr, Time, sizeof(Time) - 1)) {
+		return false;
+	}
+	const char *end = &ptr[len];
+	const char *text = memmem(ptr, len, JSONText, sizeof(JSONText) - 1);
+	if (!text) return false;
+
+	char stamp[64];
+	size_t n = 0;
+	for (const char *ch = &ptr[sizeof(Time) - 1]; ch < end && *ch != '"';) {
+		if (n + 1 < sizeof(stamp)) stamp[n++] = *ch;
+		ch++;
+	}
+	stamp[n] = '\0';
+	struct tm tm = {0};
+	if (!strptime(stamp, "%Y-%m-%dT%T", &tm)) return false;
+	*time = timegm(&tm);
+
+	n = 0;
+	for (const char *ch = &text[sizeof(JSONText) - 1]; ch < end; ++ch) {
+		if (*ch == '"') break;
+		byte utf8[3] = { *ch };
+		size_t width = 1;
+		if (*ch == '\\' && ch + 1 < end) {
+			switch (*++ch) {
+				break; case 'b': utf8[0] = '\b';
+				break; case 'f': utf8[0] = '\f';
+				break; case 'n': utf8[0] = '\n';
+				break; case 'r': utf8[0] = '\r';
+				break; case 't': utf8[0] = '\t';
+				break; case 'u': {
+					char hex[5] = "";
+					if (end - ch > 4) memcpy(hex, &ch[1], 4);
+					ch += strlen(hex);
+					unsigned long code = strtoul(hex, NULL, 16);
+					if (code < 0x80) {
+						utf8[0] = code;
+					} else if (code < 0x800) {
+						utf8[0] = 0xC0 | code >> 6;
+						utf8[1] = 0x80 | (code & 0x3F);
+						width = 2;
+					} else {
+						utf8[0] = 0xE0 | code >> 12;
+						utf8[1] = 0x80 | (code >> 6 & 0x3F);
+						utf8[2] = 0x80 | (code & 0x3F);
+						width = 3;
+					}
+					if (!code) width = 0;
+				}
+				break; default: utf8[0] = *ch;
+			}
+		}
+		if (n + width >= cap) break;
+		memcpy(&buf[n], utf8, width);
+		n += width;
+	}
+	buf[n] = '\0';
+	return true;
+}
+
+static int dateCmp(const void *_a, const void *_b) {
+	const uint32_t *a = _a, *b = _b;
+	return (*a > *b) - (*a < *b);
+}
+
+// Return the dates of the days logged in dir, oldest first.
+static uint32_t *logDates(int dir, const char *path, size_t *len) {
+	int fd = dup(dir);
+	if (fd < 0) err(1, "dup");
+	DIR *ents = fdopendir(fd);
+	if (!ents) err(1, "log/%s", path);
+	uint32_t *dates = NULL;
+	size_t cap = 0;
+	*len = 0;
+	for (struct dirent *ent; (ent = readdir(ents));) {
+		uint year, month, day;
+		int n = 0;
+		sscanf(ent->d_name, "%4u-%2u-%2u.log%n", &year, &month, &day, &n);
+		if (!n || (ent->d_name[n] && strcmp(&ent->d_name[n], ".lz"))) {
+			continue;
+		}
+		if (*len == cap) {
+			cap = (cap ? cap * 2 : 256);
+			dates = realloc(dates, sizeof(*dates) * cap);
+			if (!dates) err(1, "realloc");
+		}
+		dates[(*len)++] = year * 10000 + month * 100 + day;
+	}
+	closedir(ents);
+	qsort(dates, *len, sizeof(*dates), dateCmp);
+	size_t unique = 0;
+	for (size_t i = 0; i < *len; ++i) {
+		if (unique && dates[i] == dates[unique - 1]) continue;
+		dates[unique++] = dates[i];
+	}
+	*len = unique;
+	return dates;
+}
+
+// Return false if the line has no time, leaving it whole in buf, otherwise
+// its text without the time.
+static bool lineParse(
+	const char *ptr, size_t len, char *buf, size_t cap, time_t *time
+) {
+	if (jsonText(ptr, len, buf, cap, time)) return true;
+	if (len >= cap) len = cap - 1;
+	memcpy(buf, ptr, len);
+	buf[len] = '\0';
+
+	// Times are logged with their offset, which is applied here rather than
+	// the current one, in case logs were written under another zone or DST.
+	struct tm tm = { .tm_isdst = -1 };
+	int date = 0;
+	sscanf(
+		buf, "[%d-%d-%dT%d:%d:%d%n",
+		&tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+		&tm.tm_hour, &tm.tm_min, &tm.tm_sec, &date
+	);
+	if (!date) return false;
+	const char *end = &buf[date];
+	long offset = 0;
+	bool zoned = (end[0] == '+' || end[0] == '-');
+	for (int i = 1; zoned && i < 5; ++i) {
+		zoned = isdigit((byte)end[i]);
+	}
+	if (zoned) {
+		offset = ((end[1] - '0') * 10 + (end[2] - '0')) * 3600
+			+ ((end[3] - '0') * 10 + (end[4] - '0')) * 60;
+		if (end[0] == '-') offset = -offset;
+		end += 5;
+	}
+	end = strchr(end, ']');
+	if (!end) return false;
+	end++;
+	while (isspace((byte)*end)) end++;
+	tm.tm_year -= 1900;
+	tm.tm_mon -= 1;
+	*time = (zoned ? timegm(&tm) - offset : mktime(&tm));
+	size_t skip = end - buf;
+	memmove(buf, &buf[skip], len - skip + 1);
+	return true;
+}
+
+struct Day {
+	char *data;
+	size_t size;
+	const struct Pack *pack;
+	size_t packSize;
+	uint64_t *unpacked;
+};
+
+static const struct Pack *packMap(int dir, uint32_t date, size_t *size) {
+	char name[sizeof("YYYY-MM-DD.log.lz")];
+	dayName(name, sizeof(name), date, ".log.lz");
+	int fd = openat(dir, name, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 && errno == ENOENT) return NULL;
+	if (fd < 0) err(1, "%s", name);
+	struct stat st;
+	int error = fstat(fd, &st);
+	if (error) err(1, "%s", name);
+	*size = st.st_size;
+	if (!*size) {
+		close(fd);
+		return NULL;
+	}
+	void *ptr = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+	if (ptr == MAP_FAILED) err(1, "mmap");
+	close(fd);
+	const struct Pack *pack = packCheck(ptr, *size);
+	if (!pack) munmap(ptr, *size);
+	return pack;
+}
+
+static bool dayOpen(struct Day *day, int dir, uint32_t date) {
+	*day = (struct Day) {0};
+	day->pack = packMap(dir, date, &day->packSize);
+
+	char name[sizeof("YYYY-MM-DD.log")];
+	dayName(name, sizeof(name), date, ".log");
+	struct stat st;
+	int fd = openat(dir, name, O_RDONLY | O_CLOEXEC);
+	if (fd < 0 && errno != ENOENT) err(1, "%s", name);
+	if (fd < 0) {
+		st.st_size = 0;
+		if (!day->pack) return false;
+	} else {
+		int error = fstat(fd, &st);
+		if (error) err(1, "%s", name);
+	}
+
+	if (!day->pack) {
+		day->size = st.st_size;
+		if (day->size) {
+			day->data = mmap(NULL, day->size, PROT_READ, MAP_SHARED, fd, 0);
+			if (day->data == MAP_FAILED) err(1, "mmap");
+		}
+		close(fd);
+		return true;
+	}
+
+	size_t packed = day->pack->size;
+	day->size = packed + st.st_size;
+	day->data = malloc(day->size + 1);
+	day->unpacked = calloc(day->pack->len / 64 + 1, sizeof(*day->unpacked));
+	if (!day->data || !day->unpacked) err(1, "malloc");
+	for (size_t len = 0; fd >= 0 && len < (size_t)st.st_size;) {
+		ssize_t n = pread(
+			fd, &day->data[packed + len], st.st_size - len, len
+		);
+		if (n < 0) err(1, "%s", name);
+		if (!n) {
+			day->size = packed + len;
+			break;
+		}
+		len += n;
+	}
+	if (fd >= 0) close(fd);
+	return true;
+}
+
+// Unpack the chunks holding [pos, end), or fill a corrupt one with newlines.
+static void dayLoad(struct Day *day, size_t pos, size_t end) {
+	if (!day->pack || pos >= day->pack->size) return;
+	const struct Chunk *chunks = (const void *)&day->pack[1];
+	size_t lo = 0, hi = day->pack->len;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (chunks[mid + 1].raw > pos) {
+			hi = mid;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	for (size_t i = lo; i < day->pack->len && chunks[i].raw < end; ++i) {
+		uint64_t bit = 1ull << (i % 64);
+		if (day->unpacked[i / 64] & bit) continue;
+		day->unpacked[i / 64] |= bit;
+		size_t len = chunks[i + 1].raw - chunks[i].raw;
+		size_t n = lzDecompress(
+			(byte *)&day->data[chunks[i].raw], len,
+			(const byte *)day->pack + chunks[i].packed,
+			chunks[i + 1].packed - chunks[i].packed
+		);
+		if (n != len) memset(&day->data[chunks[i].raw], '\n', len);
+	}
+}
+
+static void dayClose(struct Day *day) {
+	if (day->pack) {
+		munmap((void *)day->pack, day->packSize);
+		free(day->unpacked);
+		free(day->data);
+	} else if (day->data) {
+		munmap(day->data, day->size);
+	}
+}
+
+// Structured lines are converted to text as it would have been logged, and
+// any other lines are copied as they are.
+void logText(const char *path) {
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) err(1, "%s", path);
+	struct stat st;
+	int error = fstat(fd, &st);
+	if (error) err(1, "%s", path);
+
+	struct Day day = { .size = st.st_size };
+	if (day.size) {
+		day.data = mmap(NULL, day.size, PROT_READ, MAP_SHARED, fd, 0);
+		if (day.data == MAP_FAILED) err(1, "mmap");
+	}
+	close(fd);
+	day.pack = packCheck(day.data, day.size);
+	if (day.pack) {
+		day.packSize = day.size;
+		day.size = day.pack->size;
+		day.data = malloc(day.size + 1);
+		day.unpacked = calloc(day.pack->len / 64 + 1, sizeof(*day.unpacked));
+		if (!day.data || !day.unpacked) err(1, "malloc");
+		dayLoad(&day, 0, day.size);
+	}
+
+	char *buf = malloc(day.size + 1);
+	if (!buf) err(1, "malloc");
+	struct Stamp stamp = {0};
+	for (size_t pos = 0, end; pos < day.size; pos = end) {
+		const char *nl = memchr(&day.data[pos], '\n', day.size - pos);
+		end = (nl ? (size_t)(nl - day.data) + 1 : day.size);
+		time_t time;
+		size_t len = end - pos - (nl ? 1 : 0);
+		if (jsonText(&day.data[pos], len, buf, len + 1, &time)) {
+			printf("[%s] %s\n", stampFormat(&stamp, "%FT%T%z", time), buf);
+		} else {
+			fwrite(&day.data[pos], end - pos, 1, stdout);
+		}
+	}
+	free(buf);
+	dayClose(&day);
+	if (fflush(stdout) || ferror(stdout)) err(1, "stdout");
+}
+
+// A window's backlog is read from the ends of its newest days backwards, a
+// chunk at a time, so only the lines it keeps are read. A line cut short at
+// the end of a day is skipped, as are lines without a time.
+enum { BacklogChunk = 16 * 1024, BacklogDays = 32 };
+
+// Return the offset after the last newline before pos, or 0, loading what
+// is before loaded as needed.
+static size_t dayBack(struct Day *day, size_t *loaded, size_t pos) {
+	for (;;) {
+		for (; pos > *loaded; --pos) {
+			if (day->data[pos - 1] == '\n') return pos;
+		}
+		if (!*loaded) return 0;
+		size_t lo = (*loaded > BacklogChunk ? *loaded - BacklogChunk : 0);
+		dayLoad(day, lo, *loaded);
+		*loaded = lo;
+	}
+}
+
+size_t logLoad(uint id, struct LogLine *lines, size_t cap) {
+	static char *buf;
+	static size_t bufCap;
+	if (logDir < 0 || !network.name || !cap) return 0;
+	char path[PATH_MAX];
+	logPath(path, &path[sizeof(path)], network.name, id);
+	int dir = openat(logDir, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (dir < 0 && (errno == ENOENT || errno == ENOTDIR)) return 0;
+	if (dir < 0) err(1, "log/%s", path);
+	size_t datesLen;
+	uint32_t *dates = logDates(dir, path, &datesLen);
+
+	// Lines are found newest first, so they fill from the end of lines,
+	// with their texts at offsets into buf until it stops moving.
+	size_t *offsets = calloc(cap, sizeof(*offsets));
+	if (!offsets) err(1, "calloc");
+	size_t n = 0, size = 0;
+	for (size_t i = datesLen; i > 0 && n < cap; --i) {
+		if (datesLen - i == BacklogDays) break;
+		struct Day day;
+		if (!dayOpen(&day, dir, dates[i - 1])) continue;
+		size_t loaded = day.size;
+		size_t end = dayBack(&day, &loaded, day.size);
+		while (end && n < cap) {
+			size_t pos = dayBack(&day, &loaded, end - 1);
+			size_t len = end - pos - 1;
+			end = pos;
+			if (size + len + 1 > bufCap) {
+				bufCap = 2 * (size + len + 1);
+				buf = realloc(buf, bufCap);
+				if (!buf) err(1, "realloc");
+			}
+			struct LogLine *line = &lines[cap - 1 - n];
+			char *text = &buf[size];
+			if (!lineParse(&day.data[pos], len, text, len + 1, &line->time)) {
+				continue;
+			}
+			bool msg = (text[0] == '<' || text[0] == '-');
+			msg |= (text[0] == '*' && text[1] == ' ');
+			line->heat = (msg ? Warm : Cold);
+			offsets[n++] = size;
+			size += strlen(text) + 1;
+		}
+		dayClose(&day);
+	}
+	free(dates);
+	close(dir);
+
+	memmove(lines, &lines[cap - n], sizeof(*lines) * n);
+	for (size_t i = 0; i < n; ++i) {
+		lines[i].str = &buf[offsets[n - 1 - i]];
+	}
+	free(offsets);
+	return n;
+}
+
+// Days before today are packed a chunk at a time in idle slices, which
+// leave most of each period to the rest of the client. A day is packed
+// into a temporary file, which replaces the day only once complete and
+// once no more lines are queued for it. A temporary file left behind by
+// a crash is either finished or removed.
+enum { PackSlice = 2 * 1000 * 1000, PackPause = 20, PackPeriod = 60 * 60 };
+
+static struct {
+	time_t scan;
+	uint64_t wake;
+	uint32_t today;
+	DIR *net;
+	DIR *chan;
+	int dir;
+	char path[PATH_MAX];
+	uint32_t date;
+	int raw;
+	size_t size;
+	size_t base;
+	int out;
+	struct Chunk *chunks;
+	size_t len;
+	size_t first;
+	size_t next;
+	byte *buf;
+	byte *packed;
+	size_t files;
+	size_t rawSize;
+	size_t packedSize;
+} pack = { .dir = -1, .raw = -1, .out = -1 };
+
+static void packWrite(const void *ptr, size_t len, off_t off) {
+	for (const char *buf = ptr; len;) {
+		ssize_t n = pwrite(pack.out, buf, len, off);
+		if (n < 0) err(1, "log/%s", pack.path);
+		buf += n;
+		len -= n;
+		off += n;
+	}
+}
+
+static void packEnd(bool done) {
+	char name[sizeof("YYYY-MM-DD.log.lz.tmp")];
+	dayName(name, sizeof(name), pack.date, ".log.lz.tmp");
+	if (!done) unlinkat(pack.dir, name, 0);
+	close(pack.out);
+	close(pack.raw);
+	pack.out = -1;
+	pack.raw = -1;
+	free(pack.chunks);
+	pack.chunks = NULL;
+}
+
+static void packStart(uint32_t date) {
+	char name[sizeof("YYYY-MM-DD.log.lz.tmp")];
+	dayName(name, sizeof(name), date, ".log");
+	pack.raw = openat(pack.dir, name, O_RDONLY | O_CLOEXEC);
+	if (pack.raw < 0 && errno == ENOENT) return;
+	if (pack.raw < 0) err(1, "log/%s/%s", pack.path, name);
+	struct stat st;
+	int error = fstat(pack.raw, &st);
+	if (error) err(1, "log/%s/%s", pack.path, name);
+	pack.size = st.st_size;
+
+	// A day packed before is copied ahead of the lines logged to it since.
+	size_t oldSize;
+	const struct Pack *old = packMap(pack.dir, date, &oldSize);
+	size_t oldLen = (old ? old->len : 0);
+	pack.base = (old ? old->size : 0);
+	pack.len = oldLen + (pack.size + PackChunk - 1) / PackChunk;
+	pack.chunks = calloc(pack.len + 1, sizeof(*pack.chunks));
+	if (!pack.chunks) err(1, "calloc");
+
+	dayName(name, sizeof(name), date, ".log.lz.tmp");
+	pack.out = openat(
+		pack.dir, name, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+		S_IRUSR | S_IWUSR
+	);
+	if (pack.out < 0) err(1, "log/%s/%s", pack.path, name);
+	pack.date = date;
+	pack.first = oldLen;
+	pack.next = oldLen;
+	uint64_t start = sizeof(*old) + sizeof(*pack.chunks) * (pack.len + 1);
+	pack.chunks[0] = (struct Chunk) { 0, start };
+	if (!old) return;
+
+	const struct Chunk *chunks = (const void *)&old[1];
+	for (size_t i = 0; i <= oldLen; ++i) {
+		pack.chunks[i].raw = chunks[i].raw;
+		pack.chunks[i].packed = start + chunks[i].packed - chunks[0].packed;
+	}
+	packWrite(
+		(const byte *)old + chunks[0].packed,
+		chunks[oldLen].packed - chunks[0].packed, start
+	);
+	munmap((void *)old, oldSize);
+}
+
+// Lines may have been logged to the day since it was opened, or still be.
+static bool packBusy(void) {
+	for (uint id = 0; id < IDCap; ++id) {
+		if (logs[id].fd < 0 || logs[id].date != pack.date) continue;
+		char path[PATH_MAX];
+		logPath(path, &path[sizeof(path)], fileNetwork, id);
+		if (!strcmp(path, pack.path)) return true;
+	}
+	struct stat st;
+	int error = fstat(pack.raw, &st);
+	if (error) err(1, "log/%s", pack.path);
+	return (size_t)st.st_size != pack.size;
+}
+
+static void packFinish(void) {
+	packWrite(
+		pack.chunks, sizeof(*pack.chunks) * (pack.len + 1),
+		sizeof(struct Pack)
+	);
+	int error = fsync(pack.out);
+	if (error) err(1, "log/%s", pack.path);
+	struct Pack header = {
+		.magic = PackMagic,
+		.len = pack.len,
+		.size = pack.chunks[pack.len].raw,
+	};
+	_Static_assert(sizeof(header) == 16, "Pack is 16 bytes");
+	packWrite(&header, sizeof(header), 0);
+	error = fsync(pack.out);
+	if (error) err(1, "log/%s", pack.path);
+	if (packBusy()) {
+		packEnd(false);
+		return;
+	}
+
+	char raw[sizeof("YYYY-MM-DD.log")];
+	char lz[sizeof("YYYY-MM-DD.log.lz")];
+	char tmp[sizeof("YYYY-MM-DD.log.lz.tmp")];
+	dayName(raw, sizeof(raw), pack.date, ".log");
+	dayName(lz, sizeof(lz), pack.date, ".log.lz");
+	dayName(tmp, sizeof(tmp), pack.date, ".log.lz.tmp");
+	error = unlinkat(pack.dir, raw, 0);
+	if (error) err(1, "log/%s/%s", pack.path, raw);
+	error = renameat(pack.dir, tmp, pack.dir, lz);
+	if (error) err(1, "log/%s/%s", pack.path, tmp);
+	pack.files++;
+	pack.rawSize += pack.size;
+	pack.packedSize += pack.chunks[pack.len].packed
+		- pack.chunks[pack.first].packed;
+	packEnd(true);
+}
+
+static void packChunk(void) {
+	if (pack.next == pack.len) {
+		packFinish();
+		return;
+	}
+	struct Chunk *chunk = &pack.chunks[pack.next++];
+	size_t off = chunk->raw - pack.base;
+	size_t len = pack.size - off;
+	if (len > PackChunk) len = PackChunk;
+	for (size_t n = 0; n < len;) {
+		ssize_t r = pread(pack.raw, &pack.buf[n], len - n, off + n);
+		if (r < 0) err(1, "log/%s", pack.path);
+		if (!r) {
+			packEnd(false);
+			return;
+		}
+		n += r;
+	}
+	size_t size = lzCompress(pack.packed, lzBound(PackChunk), pack.buf, len);
+	assert(size);
+	packWrite(pack.packed, size, chunk->packed);
+	chunk[1] = (struct Chunk) { chunk->raw + len, chunk->packed + size };
+}
+
+static void packRecover(uint32_t date) {
+	char raw[sizeof("YYYY-MM-DD.log")];
+	char tmp[sizeof("YYYY-MM-DD.log.lz.tmp")];
+	dayName(raw, sizeof(raw), date, ".log");
+	dayName(tmp, sizeof(tmp), date, ".log.lz.tmp");
+	int fd = openat(pack.dir, tmp, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) return;
+	struct Pack header;
+	ssize_t n = pread(fd, &header, sizeof(header), 0);
+	close(fd);
+	bool done = (n == sizeof(header) && header.magic == PackMagic);
+	if (done && faccessat(pack.dir, raw, F_OK, 0) && errno == ENOENT) {
+		char lz[sizeof("YYYY-MM-DD.log.lz")];
+		dayName(lz, sizeof(lz), date, ".log.lz");
+		int error = renameat(pack.dir, tmp, pack.dir, lz);
+		if (error) err(1, "log/%s/%s", pack.path, tmp);
+	} else {
+		unlinkat(pack.dir, tmp, 0);
+	}
+}
+
+static void packEntry(const char *name) {
+	uint year, month, day;
+	int len = 0;
+	sscanf(name, "%4u-%2u-%2u.log%n", &year, &month, &day, &len);
+	if (!len) return;
+	uint32_t date = year * 10000 + month * 100 + day;
+	if (!strcmp(&name[len], ".lz.tmp")) {
+		packRecover(date);
+	} else if (!name[len] && date < pack.today) {
+		packStart(date);
+	}
+}
+
+// A day is only finished once the writer has emptied the ring, so that no
+// line for it is still queued. Until then, it waits for a later slice.
+static bool packWaiting(void) {
+	if (pack.out < 0 || pack.next < pack.len) return false;
+	if (atomic_load(&queue.tail) == atomic_load(&queue.head)) return false;
+	logWake();
+	return true;
+}
+
+// Return false once every day has been looked at.
+static bool packStep(void) {
+	if (pack.out >= 0) {
+		packChunk();
+		return true;
+	}
+	if (pack.chan) {
+		struct dirent *ent = readdir(pack.chan);
+		if (ent) {
+			packEntry(ent->d_name);
+			return true;
+		}
+		closedir(pack.chan);
+		close(pack.dir);
+		pack.chan = NULL;
+		pack.dir = -1;
+	}
+	struct dirent *ent = readdir(pack.net);
+	if (!ent) {
+		closedir(pack.net);
+		pack.net = NULL;
+		return false;
+	}
+	if (ent->d_name[0] == '.') return true;
+	char *ptr = pack.path, *end = &pack.path[sizeof(pack.path)];
+	ptr = seprintf(ptr, end, "%s", fileNetwork);
+	sanitize(pack.path, ptr);
+	seprintf(ptr, end, "/%s", ent->d_name);
+	pack.dir = openat(
+		logDir, pack.path, O_RDONLY | O_DIRECTORY | O_CLOEXEC
+	);
+	if (pack.dir < 0) return true;
+	int fd = dup(pack.dir);
+	if (fd < 0) err(1, "dup");
+	pack.chan = fdopendir(fd);
+	if (!pack.chan) err(1, "log/%s", pack.path);
+	return true;
+}
+
+int logIdle(void) {
+	if (!logPack || logDir < 0 || !fileNetwork) return -1;
+	uint64_t start = nsec();
+	if (start < pack.wake) return (pack.wake - start) / 1000000 + 1;
+	time_t now = time(NULL);
+	if (!pack.net) {
+		if (now < pack.scan) return (pack.scan - now) * 1000;
+		char path[PATH_MAX];
+		char *ptr = seprintf(path, &path[sizeof(path)], "%s", fileNetwork);
+		sanitize(path, ptr);
+		int fd = openat(logDir, path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+		if (fd < 0) err(1, "log/%s", path);
+		pack.net = fdopendir(fd);
+		if (!pack.net) err(1, "log/%s", path);
+		pack.today = logDate(stampLocal(now));
+		if (!pack.buf) {
+			pack.buf = malloc(PackChunk);
+			pack.packed = malloc(lzBound(PackChunk));
+			if (!pack.buf || !pack.packed) err(1, "malloc");
+		}
+	}
+	while (nsec() - start < PackSlice && !packWaiting()) {
+		if (packStep()) continue;
+		pack.scan = now + PackPeriod;
+		return PackPeriod * 1000;
+	}
+	pack.wake = nsec() + PackPause * 1000000;
+	return PackPause;
+}
+
+void logClose(void) {
+	if (logDir < 0) return;
+	if (!atomic_load(&queue.error)) {
+		for (uint id = 0; id < IDCap; ++id) {
+			indexFlush(id);
+		}
+	}
+	atomic_store(&queue.done, true);
+	logWake();
+	pthread_join(queue.thread, NULL);
+	if (pack.out >= 0) packEnd(false);
+	close(logDir);
+	logDir = -1;
+	for (uint id = 0; id < IDCap; ++id) {
+		if (logs[id].fd >= 0) close(logs[id].fd);
+		if (logs[id].index >= 0) close(logs[id].index);
+	}
+	logCheck();
+}
+
+void logStats(struct LogStats *stats) {
+	stats->depth = atomic_load(&queue.head) - atomic_load(&queue.tail);
+	stats->depthMax = depthMax;
+	stats->dropped = dropped;
+	stats->written = atomic_load(&written);
+	stats->batches = atomic_load(&batches);
+	stats->latency = atomic_load(&latency);
+	stats->latencyMax = atomic_load(&latencyMax);
+	stats->files = fileLen;
+	stats->fileCap = fileCap;
+	stats->hits = hits;
+	stats->misses = misses;
+	stats->evictions = evictions;
+	stats->packFiles = pack.files;
+	stats->packRaw = pack.rawSize;
+	stats->packPacked = pack.packedSize;
+}
+
+// Logs are searched newest first for the most recent matches, which are then
+// listed oldest first with a line of context either side.
+enum { SearchCap = 500 };
+
+static struct {
+	uint id;
+	int dir;
+	char path[PATH_MAX];
+	struct Query {
+		char *str;
+		size_t len;
+		uint *grams;
+		size_t gramsLen;
+	} queries[2];
+	size_t queriesLen;
+	char *buf;
+	size_t cap;
+	uint32_t *lines;
+	size_t linesLen;
+	size_t linesCap;
+} search;
+
+static struct Match {
+	uint32_t date;
+	uint32_t offset;
+} matches[SearchCap];
+
+// Structured lines are searched for the query as escaped in them as well.
+static void searchQuery(const char *str, size_t len) {
+	struct Query *query = &search.queries[search.queriesLen++];
+	query->len = len;
+	query->str = malloc(len + 1);
+	query->grams = calloc(len + 1, sizeof(*query->grams));
+	if (!query->str || !query->grams) err(1, "malloc");
+	for (size_t i = 0; i < len; ++i) {
+		query->str[i] = fold[(byte)str[i]];
+	}
+	query->str[len] = '\0';
+	query->gramsLen = 0;
+	for (size_t i = 0; i + 3 <= len; ++i) {
+		query->grams[query->gramsLen++] = indexGram(&str[i]);
+	}
+}
+
+static bool indexMatch(const struct Index *block) {
+	for (size_t i = 0; i < search.queriesLen; ++i) {
+		const struct Query *query = &search.queries[i];
+		size_t j;
+		for (j = 0; j < query->gramsLen; ++j) {
+			uint gram = query->grams[j];
+			if (!(block->grams[gram / 64] & 1ull << (gram % 64))) break;
+		}
+		if (j == query->gramsLen) return true;
+	}
+	return false;
+}
+
+static const char *searchFind(const char *ptr, const char *end) {
+	const char *first = NULL;
+	for (size_t i = 0; i < search.queriesLen; ++i) {
+		const struct Query *query = &search.queries[i];
+		const char *match = memmem(ptr, end - ptr, query->str, query->len);
+		if (match && (!first || match < first)) first = match;
+	}
+	return first;
+}
+
+static void searchChunk(const char *data, size_t pos, size_t end) {
+	size_t len = end - pos;
+	if (len > search.cap) {
+		search.buf = realloc(search.buf, len);
+		if (!search.buf) err(1, "realloc");
+		search.cap = len;
+	}
+	for (size_t i = 0; i < len; ++i) {
+		search.buf[i] = fold[(byte)data[pos + i]];
+	}
+	const char *buf = search.buf;
+	const char *last = &buf[len];
+	const char *ptr = buf;
+	while ((ptr = searchFind(ptr, last))) {
+		const char *line = ptr;
+		while (line > buf && line[-1] != '\n') line--;
+		// Only the text of a structured line is searched.
+		const char *nl = memchr(line, '\n', last - line);
+		const char *text = NULL;
+		if (line[0] == '{') {
+			size_t size = (nl ? nl : last) - line;
+			text = memmem(line, size, JSONText, sizeof(JSONText) - 1);
+		}
+		if (text && ptr < &text[sizeof(JSONText) - 1]) {
+			ptr = &text[sizeof(JSONText) - 1];
+			continue;
+		}
+		if (search.linesLen == search.linesCap) {
+			search.linesCap = (search.linesCap ? search.linesCap * 2 : 64);
+			search.lines = realloc(
+				search.lines, sizeof(*search.lines) * search.linesCap
+			);
+			if (!search.lines) err(1, "realloc");
+		}
+		search.lines[search.linesLen++] = pos + (line - buf);
+		if (!nl) break;
+		ptr = &nl[1];
+	}
+}
+
+// Regions without blocks are split into blocks of whole lines, indexed unless
+// logFormat() is yet to index them itself.
+static void searchGap(uint32_t date, struct Day *day, size_t pos, size_t end) {
+	dayLoad(day, pos, end);
+	const char *data = day->data;
+	size_t since = SIZE_MAX;
+	if (logs[search.id].date == date) since = logs[search.id].since;
+	while (pos < end) {
+		size_t next = end;
+		if (end - pos > IndexBlock) {
+			next = pos + IndexBlock;
+			while (next > pos && data[next - 1] != '\n') next--;
+			if (next == pos) {
+				const char *nl = memchr(
+					&data[pos + IndexBlock], '\n', end - pos - IndexBlock
+				);
+				next = (nl ? (size_t)(nl - data) + 1 : end);
+			}
+		}
+		if (data[next - 1] == '\n' && next <= since && next <= UINT32_MAX) {
+			struct Index block = {
+				.magic = IndexMagic,
+				.date = date,
+				.offset = pos,
+				.len = next - pos,
+			};
+			indexGrams(&block, &data[pos], next - pos);
+			indexWrite(search.path, &block);
+			if (indexMatch(&block)) searchChunk(data, pos, next);
+		} else {
+			searchChunk(data, pos, next);
+		}
+		pos = next;
+	}
+}
+
+static void searchFile(
+	uint32_t date, const struct Index **blocks, size_t len, size_t *n
+) {
+	struct Day day;
+	if (!dayOpen(&day, search.dir, date)) return;
+	search.linesLen = 0;
+	size_t pos = 0;
+	for (size_t i = 0; i < len; ++i) {
+		const struct Index *block = blocks[i];
+		size_t end = (size_t)block->offset + block->len;
+		if (block->offset < pos || end > day.size) continue;
+		searchGap(date, &day, pos, block->offset);
+		if (indexMatch(block)) {
+			dayLoad(&day, block->offset, end);
+			searchChunk(day.data, block->offset, end);
+		}
+		pos = end;
+	}
+	searchGap(date, &day, pos, day.size);
+	dayClose(&day);
+	while (search.linesLen && *n < SearchCap) {
+		matches[(*n)++] = (struct Match) {
+			date, search.lines[--search.linesLen]
+		};
+	}
+}
+
+static size_t lineEnd(const struct Day *day, size_t pos) {
+	const char *nl = memchr(&day->data[pos], '\n', day->size - pos);
+	return (nl ? (size_t)(nl - day->data) + 1 : day->size);
+}
+
+static void searchLine(
+	uint out, enum Heat heat, const struct Day *day, size_t pos, size_t end
+) {
+	char line[1024];
+	size_t len = end - pos;
+	if (len && day->data[end - 1] == '\n') len--;
+	time_t time;
+	bool stamped = lineParse(
+		&day->data[pos], len, line, sizeof(line), &time
+	);
+	uiFormat(out, heat, (stamped ? &time : NULL), "%s", line);
+}
+
+static void searchAfter(uint out, const struct Day *day, size_t *printed) {
+	if (*printed >= day->size) return;
+	size_t end = lineEnd(day, *printed);
+	searchLine(out, Cold, day, *printed, end);
+	*printed = end;
+}
+
+static void searchPrint(uint out, size_t n) {
+	struct Day day = {0};
+	bool open = false, after = false;
+	uint32_t date = 0;
+	size_t printed = 0;
+	for (size_t i = n; i > 0; --i) {
+		const struct Match *match = &matches[i - 1];
+		if (match->date != date) {
+			if (after) searchAfter(out, &day, &printed);
+			if (open) dayClose(&day);
+			date = match->date;
+			open = dayOpen(&day, search.dir, date);
+			if (open) dayLoad(&day, 0, day.size);
+			printed = 0;
+			after = false;
+			uiFormat(
+				out, Cold, NULL, "\3%02d%s\3 \2%u-%02u-%02u",
+				idColors[search.id], idNames[search.id],
+				date / 10000, date / 100 % 100, date % 100
+			);
+		}
+		if (!open || match->offset >= day.size) continue;
+		if (after && printed < match->offset) {
+			searchAfter(out, &day, &printed);
+		}
+		size_t before = match->offset;
+		if (before) {
+			for (before--; before && day.data[before - 1] != '\n'; --before);
+		}
+		if (before < printed) before = printed;
+		while (before < match->offset) {
+			size_t end = lineEnd(&day, before);
+			searchLine(out, Cold, &day, before, end);
+			before = end;
+		}
+		printed = lineEnd(&day, match->offset);
+		searchLine(out, Warm, &day, match->offset, printed);
+		after = true;
+	}
+	if (after) searchAfter(out, &day, &printed);
+	if (open) dayClose(&day);
+}
+
+
+static int blockCmp(const void *_a, const void *_b) {
+	const struct Index *const *a = _a, *const *b = _b;
+	if ((*a)->date != (*b)->date) return ((*a)->date < (*b)->date ? -1 : +1);
+	return ((*a)->offset > (*b)->offset) - ((*a)->offset < (*b)->offset);
+}
+
+void logSearch(uint id, const char *str) {
+	if (logDir < 0) {
+		uiFormat(id, Warm, NULL, "Logging is not enabled");
+		return;
+	}
+	uint64_t start = nsec();
+	logSettle();
+	search.id = id;
+	logPath(search.path, &search.path[sizeof(search.path)], network.name, id);
+	search.dir = openat(logDir, search.path, O_RDONLY | O_CLOEXEC);
+	if (search.dir < 0 && errno == ENOENT) {
+		uiFormat(
+			id, Warm, NULL, "No logs of \3%02d%s\3",
+			idColors[id], idNames[id]
+		);
+		return;
+	}
+	if (search.dir < 0) err(1, "log/%s", search.path);
+
+	search.queriesLen = 0;
+	searchQuery(str, strlen(str));
+	char *json = malloc(jsonString(NULL, 0, str));
+	if (!json) err(1, "malloc");
+	size_t jsonLen = jsonString(json, 0, str) - 2;
+	if (jsonLen != search.queries[0].len) searchQuery(&json[1], jsonLen);
+	free(json);
+
+	size_t datesLen;
+	uint32_t *dates = logDates(search.dir, search.path, &datesLen);
+
+	const struct Index *index = NULL;
+	size_t indexLen = 0;
+	int fd = openat(search.dir, "index", O_RDONLY | O_CLOEXEC);
+	if (fd < 0 && errno != ENOENT) err(1, "log/%s/index", search.path);
+	if (fd >= 0) {
+		struct stat st;
+		int error = fstat(fd, &st);
+		if (error) err(1, "log/%s/index", search.path);
+		indexLen = st.st_size / sizeof(*index);
+		if (indexLen) {
+			index = mmap(
+				NULL, sizeof(*index) * indexLen, PROT_READ, MAP_SHARED, fd, 0
+			);
+			if (index == MAP_FAILED) err(1, "mmap");
+		}
+		close(fd);
+	}
+	const struct Index **blocks = calloc(indexLen + 1, sizeof(*blocks));
+	if (!blocks) err(1, "calloc");
+	size_t blocksLen = 0;
+	for (size_t i = 0; i < indexLen; ++i) {
+		if (index[i].magic == IndexMagic) blocks[blocksLen++] = &index[i];
+	}
+	qsort(blocks, blocksLen, sizeof(*blocks), blockCmp);
+
+	size_t n = 0;
+	for (size_t i = datesLen, j = blocksLen; i > 0 && n < SearchCap; --i) {
+		uint32_t date = dates[i - 1];
+		while (j > 0 && blocks[j - 1]->date > date) j--;
+		size_t k = j;
+		while (k > 0 && blocks[k - 1]->date == date) k--;
+		searchFile(date, &blocks[k], j - k, &n);
+		j = k;
+	}
+
+	uint out = idFor("<history>");
+	uiFormat(
+		out, Warm, NULL, "Searching logs of \3%02d%s\3 for \3%02d%s",
+		idColors[id], idNames[id], Brown, str
+	);
+	searchPrint(out, n);
+	uiFormat(
+		out, Warm, NULL,
+		"Search for \3%02d%s\3 found %s%zu result%s in %ju ms",
+		Brown, str, (n == SearchCap ? "the last " : ""),
+		n, (n == 1 ? "" : "s"), (uintmax_t)((nsec() - start) / 1000000)
+	);
+	windowShow(windowFor(out));
+
+	free(blocks);
+	if (index) munmap((void *)index, sizeof(*index) * indexLen);
+	free(dates);
+	for (size_t i = 0; i < search.queriesLen; ++i) {
+		free(search.queries[i].grams);
+		free(search.queries[i].str);
+	}
+	close(search.dir);
 }
@@ -0,0 +1,208 @@
+/* Copyright (C) 2026  The catgirlrx contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7:
+ *
+ * If you modify this Program, or any covered work, by linking or
+ * combining it with OpenSSL (or a modified version of that library),
+ * containing parts covered by the terms of the OpenSSL License and the
+ * original SSLeay license, the licensors of this Program grant you
+ * additional permission to convey the resulting work. Corresponding
+ * Source for a non-source form of such a combination shall include the
+ * source code for the parts of OpenSSL used as well as that of the
+ * covered work.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "chat.h"
+
+// A byte-oriented LZ77 in the style of LZ4. Each sequence is a token byte
+// holding literal and match lengths in its high and low nibbles, extended
+// by runs of 255, followed by the literals and a 16-bit little-endian
+// offset. The final sequence carries only literals.
+
+enum {
+	MinMatch = 4,
+	MaxOffset = 0xFFFF,
+	HashBits = 12,
+};
+
+static uint32_t read32(const byte *ptr) {
+	uint32_t x;
+	memcpy(&x, ptr, sizeof(x));
+	return x;
+}
+
+static uint hash4(const byte *ptr) {
+	return (read32(ptr) * 2654435761u) >> (32 - HashBits);
+}
+
+size_t lzBound(size_t len) {
+	return len + len / 255 + 16;
+}
+
+static byte *putLen(byte *ptr, byte *end, size_t len) {
+	for (; len >= 255; len -= 255) {
+		if (ptr == end) return NULL;
+		*ptr++ = 255;
+	}
+	if (ptr == end) return NULL;
+	*ptr++ = len;
+	return ptr;
+}
+
+static byte *sequence(
+	byte *ptr, byte *end, const byte *lit, size_t litLen,
+	size_t offset, size_t matchLen
+) {
+	if (ptr == end) return NULL;
+	byte *token = ptr++;
+	*token = (litLen < 15 ? litLen : 15) << 4;
+	if (litLen >= 15 && !(ptr = putLen(ptr, end, litLen - 15))) return NULL;
+	if ((size_t)(end - ptr) < litLen) return NULL;
+	memcpy(ptr, lit, litLen);
+	ptr += litLen;
+	if (!matchLen) return ptr;
+
+	if (end - ptr < 2) return NULL;
+	*ptr++ = offset & 0xFF;
+	*ptr++ = offset >> 8;
+	matchLen -= MinMatch;
+	*token |= (matchLen < 15 ? matchLen : 15);
+	if (matchLen >= 15) ptr = putLen(ptr, end, matchLen - 15);
+	return ptr;
+}
+
+size_t lzCompress(byte *dst, size_t cap, const byte *src, size_t len) {
+	uint32_t table[1 << HashBits] = {0};
+	byte *ptr = dst, *end = &dst[cap];
+	const byte *anchor = src, *pos = src, *tail = &src[len];
+	while (tail - pos >= MinMatch) {
+		uint h = hash4(pos);
+		const byte *ref = &src[table[h]];
+		table[h] = pos - src;
+		if (ref >= pos || pos - ref > MaxOffset || read32(ref) != read32(pos)) {
+			pos++;
+			continue;
+		}
+		const byte *match = &pos[MinMatch];
+		for (ref += MinMatch; match < tail && *match == *ref; ++match, ++ref);
+		ptr = sequence(
+			ptr, end, anchor, pos - anchor, match - ref, match - pos
+		);
+		if (!ptr) return 0;
+		pos = anchor = match;
+	}
+	ptr = sequence(ptr, end, anchor, tail - anchor, 0, 0);
+	return (ptr ? ptr - dst : 0);
+}
+
+static const byte *getLen(const byte *ptr, const byte *end, size_t *len) {
+	byte b;
+	do {
+		if (ptr == end) return NULL;
+		b = *ptr++;
+		*len += b;
+	} while (b == 255);
+	return ptr;
+}
+
+size_t lzDecompress(byte *dst, size_t cap, const byte *src, size_t len) {
+	byte *ptr = dst, *end = &dst[cap];
+	const byte *in = src, *tail = &src[len];
+	while (in < tail) {
+		byte token = *in++;
+		size_t litLen = token >> 4;
+		if (litLen == 15 && !(in = getLen(in, tail, &litLen))) return 0;
+		if ((size_t)(tail - in) < litLen) return 0;
+		if ((size_t)(end - ptr) < litLen) return 0;
+		memcpy(ptr, in, litLen);
+		ptr += litLen;
+		in += litLen;
+		if (in == tail) break;
+
+		if (tail - in < 2) return 0;
+		size_t offset = in[0] | in[1] << 8;
+		in += 2;
+		if (!offset || offset > (size_t)(ptr - dst)) return 0;
+		size_t matchLen = token & 15;
+		if (matchLen == 15 && !(in = getLen(in, tail, &matchLen))) return 0;
+		matchLen += MinMatch;
+		if ((size_t)(end - ptr) < matchLen) return 0;
+		const byte *ref = ptr - offset;
+		if (offset >= matchLen) {
+			memcpy(ptr, ref, matchLen);
+			ptr += matchLen;
+		} else {
+			while (matchLen--) *ptr++ = *ref++;
+		}
+	}
+	return ptr - dst;
+}
+
+#ifdef TEST
+#undef NDEBUG
+#include <assert.h>
+#include <stdio.h>
+
+static size_t roundtrip(const char *str, size_t len) {
+	size_t cap = lzBound(len);
+	byte *packed = malloc(cap);
+	byte *unpacked = malloc(len + 1);
+	assert(packed && unpacked);
+	size_t size = lzCompress(packed, cap, (const byte *)str, len);
+	assert(size);
+	assert(len == lzDecompress(unpacked, len, packed, size));
+	assert(!memcmp(str, unpacked, len));
+	if (len > 1) assert(!lzDecompress(unpacked, len - 1, packed, size));
+	free(packed);
+	free(unpacked);
+	return size;
+}
+
+int main(void) {
+	assert(1 == roundtrip("", 0));
+	assert(2 == roundtrip("a", 1));
+	roundtrip("abc", 3);
+	roundtrip("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 53);
+	roundtrip("abcabcabcabcabcabcabcabcabc", 27);
+
+	char buf[64 * 1024];
+	char *ptr = buf, *end = &buf[sizeof(buf)];
+	for (uint i = 0; ptr < end; ++i) {
+		ptr = seprintf(
+			ptr, end, "\3%02d<bot>\3 [build #%u] master: passed in %us%c",
+			i % 16, i, i * 7 % 60, '\0'
+		);
+	}
+	size_t len = ptr - buf;
+	assert(roundtrip(buf, len) < len / 4);
+
+	uint32_t x = 1;
+	for (size_t i = 0; i < sizeof(buf); ++i) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		buf[i] = x;
+	}
+	assert(roundtrip(buf, sizeof(buf)) <= lzBound(sizeof(buf)));
+
+	byte garbage[] = { 0x0F, 0x01, 0xFF, 0xFF };
+	assert(!lzDecompress((byte *)buf, sizeof(buf), garbage, sizeof(garbage)));
+}
+
+#endif /* TEST */
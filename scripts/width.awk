@@ -0,0 +1,107 @@
+# Generate width.h from UnicodeData.txt and EastAsianWidth.txt:
+#
+#	awk -f scripts/width.awk UnicodeData.txt EastAsianWidth.txt > width.h
+#
+# Widths follow wcwidth(3) conventions: -1 for controls, surrogates,
+# separators and unassigned code points, 0 for NUL, combining marks, format
+# characters and medial Hangul jamo, 2 for wide and fullwidth, otherwise 1.
+# Widths are stored offset by one, two bits each, in blocks of 256 code
+# points, and identical blocks are shared.
+
+function hex(str,  i, n) {
+	n = 0
+	str = toupper(str)
+	for (i = 1; i <= length(str); ++i) {
+		n = n * 16 + index("0123456789ABCDEF", substr(str, i, 1)) - 1
+	}
+	return n
+}
+
+BEGIN {
+	FS = ";"
+}
+
+FILENAME ~ /UnicodeData/ {
+	cp = hex($1)
+	gc[cp] = $3
+	if ($2 ~ /, First>$/) first = cp
+	if ($2 ~ /, Last>$/) for (i = first; i < cp; ++i) gc[i] = $3
+	next
+}
+
+FILENAME ~ /EastAsianWidth/ && FNR == 1 {
+	version = $0
+	sub(/^# EastAsianWidth-/, "", version)
+	sub(/\.txt.*$/, "", version)
+}
+
+FILENAME ~ /EastAsianWidth/ && /^[0-9A-Fa-f]/ {
+	sub(/[ \t]*#.*$/, "")
+	gsub(/[ \t]/, "")
+	if ($2 != "W" && $2 != "F") next
+	n = split($1, range, /\.\./)
+	lo = hex(range[1])
+	hi = (n > 1 ? hex(range[2]) : lo)
+	for (i = lo; i <= hi; ++i) wide[i] = 1
+}
+
+function width(cp,  c) {
+	c = (cp in gc ? gc[cp] : "Cn")
+	if (!cp) return 0
+	if (c ~ /^(Cc|Cs|Cn|Zl|Zp)$/) return -1
+	if (c ~ /^(Mn|Me)$/ || (c == "Cf" && cp != 173)) return 0
+	if (cp >= 4448 && cp <= 4607) return 0
+	if (cp in wide) return 2
+	return 1
+}
+
+END {
+	blocks = 0
+	for (b = 0; b < 4352; ++b) {
+		key = ""
+		for (i = 0; i < 64; ++i) {
+			cell = 0
+			for (j = 0; j < 4; ++j) {
+				cell += (width(b * 256 + i * 4 + j) + 1) * 4 ^ j
+			}
+			if (i) key = key (i % 16 ? ", " : ",\n\t\t")
+			key = key cell
+		}
+		if (!(key in index_)) {
+			index_[key] = blocks
+			cells[blocks++] = key
+		}
+		block[b] = index_[key]
+	}
+
+	print "// Generated by scripts/width.awk from Unicode " version "."
+	print "// Do not edit."
+	print ""
+	print "#include <wchar.h>"
+	print ""
+	type = (blocks > 256 ? "unsigned short" : "unsigned char")
+	print "static const " type " WidthBlocks[0x110000 >> 8] = {"
+	line = "\t"
+	for (b = 0; b < 4352; ++b) {
+		line = line block[b] ","
+		if (b % 16 == 15) {
+			print line
+			line = "\t"
+		} else {
+			line = line " "
+		}
+	}
+	print "};"
+	print ""
+	print "static const unsigned char WidthCells[][64] = {"
+	for (i = 0; i < blocks; ++i) {
+		print "\t{\n\t\t" cells[i] ",\n\t},"
+	}
+	print "};"
+	print ""
+	print "static inline int charWidth(wchar_t ch) {"
+	print "\tif ((unsigned long)ch > 0x10FFFF) return -1;"
+	print "\tunsigned cell = WidthCells[WidthBlocks[ch >> 8]][(ch & 0xFF) >> 2];"
+	print "\treturn (cell >> (ch & 3) * 2 & 3) - 1;"
+	print "}"
+}
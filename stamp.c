@@ -0,0 +1,138 @@
+/* Copyright (C) 2026  The catgirlrx contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Additional permission under GNU GPL version 3 section 7:
+ *
+ * If you modify this Program, or any covered work, by linking or
+ * combining it with OpenSSL (or a modified version of that library),
+ * containing parts covered by the terms of the OpenSSL License and the
+ * original SSLeay license, the licensors of this Program grant you
+ * additional permission to convey the resulting work. Corresponding
+ * Source for a non-source form of such a combination shall include the
+ * source code for the parts of OpenSSL used as well as that of the
+ * covered work.
+ */
+
+#include <err.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "chat.h"
+
+// Broken-down local time only changes its offset on minute boundaries, so
+// localtime(3) is called once per minute and the seconds are filled in.
+static struct {
+	bool valid;
+	time_t minute;
+	struct tm tm;
+} local;
+
+const struct tm *stampLocal(time_t time) {
+	int sec = (time % 60 + 60) % 60;
+	time_t minute = time - sec;
+	if (!local.valid || minute != local.minute) {
+		struct tm *tm = localtime(&minute);
+		if (!tm) err(1, "localtime");
+		local.tm = *tm;
+		local.minute = minute;
+		local.valid = true;
+	}
+	static struct tm tm;
+	tm = local.tm;
+	tm.tm_sec = sec;
+	return &tm;
+}
+
+// Each minute is formatted once. If its seconds land in one place in the
+// output, later seconds of the same minute are patched in without calling
+// strftime(3). Results are also remembered by time, so redrawing the same
+// lines costs a lookup.
+const char *stampFormat(struct Stamp *stamp, const char *format, time_t time) {
+	struct StampMemo *memo = &stamp->memo[(size_t)time % StampMemos];
+	if (stamp->format == format && memo->valid && memo->time == time) {
+		return memo->str;
+	}
+	if (stamp->format != format) {
+		memset(stamp, 0, sizeof(*stamp));
+		stamp->format = format;
+	}
+
+	const struct tm *tm = stampLocal(time);
+	time_t minute = time - tm->tm_sec;
+	if (!stamp->valid || stamp->minute != minute) {
+		struct tm a = *tm, b = *tm;
+		a.tm_sec = 12;
+		b.tm_sec = 34;
+		char other[StampCap];
+		size_t len = strftime(stamp->str, sizeof(stamp->str), format, &a);
+		if (len != strftime(other, sizeof(other), format, &b)) len = 0;
+		stamp->slot = -1;
+		for (size_t i = 0; i < len; ++i) {
+			if (stamp->str[i] == other[i]) continue;
+			if (stamp->slot >= 0 || memcmp(&stamp->str[i], "12", 2)) {
+				stamp->slot = -1;
+				break;
+			}
+			if (memcmp(&other[i], "34", 2)) break;
+			stamp->slot = i++;
+		}
+		// Seconds without a leading zero, as from %-S, change the length.
+		if (stamp->slot >= 0) {
+			struct tm c = *tm;
+			c.tm_sec = 5;
+			char patched[StampCap];
+			memcpy(patched, stamp->str, sizeof(patched));
+			memcpy(&patched[stamp->slot], "05", 2);
+			strftime(other, sizeof(other), format, &c);
+			if (strcmp(patched, other)) stamp->slot = -1;
+		}
+		stamp->minute = minute;
+		stamp->valid = true;
+	}
+
+	if (stamp->slot >= 0) {
+		memcpy(memo->str, stamp->str, sizeof(memo->str));
+		memo->str[stamp->slot + 0] = '0' + tm->tm_sec / 10;
+		memo->str[stamp->slot + 1] = '0' + tm->tm_sec % 10;
+	} else {
+		strftime(memo->str, sizeof(memo->str), format, tm);
+	}
+	memo->time = time;
+	memo->valid = true;
+	return memo->str;
+}
+
+#ifdef TEST
+#undef NDEBUG
+#include <assert.h>
+
+int main(void) {
+	const char *formats[] = {
+		"%X", "%FT%T%z", "%H:%M", "%S:%S", "%s", "%-S", "%M:%-S", "",
+	};
+	struct Stamp stamp = {0};
+	for (size_t f = 0; f < ARRAY_LEN(formats); ++f) {
+		for (time_t time = 1700000000; time < 1700000000 + 3 * 3600; time += 7) {
+			char buf[StampCap] = "";
+			strftime(buf, sizeof(buf), formats[f], localtime(&time));
+			assert(!strcmp(buf, stampFormat(&stamp, formats[f], time)));
+			assert(!strcmp(buf, stampFormat(&stamp, formats[f], time)));
+		}
+	}
+}
+
+#endif /* TEST */
@@ -33,12 +33,17 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/file.h>
+#include <sys/stat.h>
 #include <term.h>
 #include <time.h>
 #include <unistd.h>
@@ -57,7 +62,17 @@ WINDOW *uiStatus;
 WINDOW *uiMain;
 WINDOW *uiInput;
 
+// Pairs past the first 16 are allocated on demand and looked up by
+// foreground and background, offset by one for the default colour. When
+// the terminal runs out, the least recently used pair is reused.
 static short colorPairs;
+static short colorPairCap;
+static short colorPairTable[1 + 256][1 + 256];
+static struct {
+	short fg, bg;
+	uint use;
+} *colorPairInfo;
+static uint colorPairClock;
 
 static void colorInit(void) {
 	start_color();
@@ -67,6 +82,10 @@ static void colorInit(void) {
 		init_pair(1 + pair, pair % COLORS, -1);
 	}
 	colorPairs = 17;
+	colorPairCap = (COLOR_PAIRS < SHRT_MAX ? COLOR_PAIRS : SHRT_MAX);
+	if (colorPairCap < colorPairs) colorPairCap = colorPairs;
+	colorPairInfo = calloc(colorPairCap, sizeof(*colorPairInfo));
+	if (!colorPairInfo) err(1, "calloc");
 }
 
 static attr_t colorAttr(short fg) {
@@ -81,13 +100,27 @@ static short colorPair(short fg, short bg) {
 	fg %= COLORS;
 	bg %= COLORS;
 	if (bg == -1 && fg < 16) return 1 + fg;
-	for (short pair = 17; pair < colorPairs; ++pair) {
-		short f, b;
-		pair_content(pair, &f, &b);
-		if (f == fg && b == bg) return pair;
+	short *pair = &colorPairTable[1 + fg][1 + bg];
+	if (!*pair) {
+		if (colorPairs < colorPairCap) {
+			*pair = colorPairs++;
+		} else if (colorPairCap > 17) {
+			short lru = 17;
+			for (short p = 18; p < colorPairCap; ++p) {
+				if (colorPairInfo[p].use < colorPairInfo[lru].use) lru = p;
+			}
+			short f = colorPairInfo[lru].fg, b = colorPairInfo[lru].bg;
+			colorPairTable[1 + f][1 + b] = 0;
+			*pair = lru;
+		} else {
+			return 0;
+		}
+		init_pair(*pair, fg, bg);
+		colorPairInfo[*pair].fg = fg;
+		colorPairInfo[*pair].bg = bg;
 	}
-	init_pair(colorPairs, fg, bg);
-	return colorPairs++;
+	colorPairInfo[*pair].use = ++colorPairClock;
+	return *pair;
 }
 
 // XXX: Assuming terminals will be fine with these even if they're unsupported,
@@ -125,6 +158,7 @@ void uiInit(void) {
 
 	uiMain = newwin(MAIN_LINES, COLS, StatusLines, 0);
 	if (!uiMain) err(1, "newwin");
+	idlok(uiMain, true);
 
 	uiInput = newpad(InputLines, InputCols);
 	if (!uiInput) err(1, "newpad");
@@ -138,8 +172,17 @@ static bool hidden = true;
 char uiTitle[TitleCap];
 static char prevTitle[TitleCap];
 
+uint uiDirty;
+uint uiFrameRate = 60;
+static struct timespec frame;
+
 void uiDraw(void) {
 	if (hidden) return;
+	windowDraw();
+	inputDraw();
+	uiDirty = 0;
+	clock_gettime(CLOCK_MONOTONIC, &frame);
+
 	wnoutrefresh(uiStatus);
 	wnoutrefresh(uiMain);
 	int y, x;
@@ -162,6 +205,22 @@ void uiDraw(void) {
 	fflush(stdout);
 }
 
+// Handlers only mark what needs drawing. Draw it if a frame is due, or now
+// after input, otherwise return the poll(2) timeout until the next frame.
+int uiFrame(bool now) {
+	if (hidden || !uiDirty) return -1;
+	if (!now) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		long elapsed = (ts.tv_sec - frame.tv_sec) * 1000
+			+ (ts.tv_nsec - frame.tv_nsec) / 1000000;
+		long interval = 1000 / uiFrameRate;
+		if (elapsed >= 0 && elapsed < interval) return interval - elapsed;
+	}
+	uiDraw();
+	return -1;
+}
+
 static const short Colors[ColorCap] = {
 	[Default]    = -1,
 	[White]      = 8 + COLOR_WHITE,
@@ -214,6 +273,7 @@ void uiShow(void) {
 	putp(PasteMode[true]);
 	fflush(stdout);
 	hidden = false;
+	uiDirty |= DrawStatus | DrawMain | DrawInput;
 	windowUnmark();
 }
 
@@ -278,6 +338,7 @@ void uiResize(void) {
 }
 
 static FILE *saveFile;
+static off_t saveSize;
 
 static const uint64_t Signatures[] = {
 	0x6C72696774616301, // no heat, unread, unreadWarm
@@ -288,7 +349,8 @@ static const uint64_t Signatures[] = {
 	0x6C72696774616306, // no thresh
 	0x6C72696774616307, // no window time
 	0x6C72696774616308, // no input
-	0x6C72696774616309,
+	0x6C72696774616309, // no window section table
+	0x6C7269677461630A,
 };
 
 static size_t signatureVersion(uint64_t signature) {
@@ -302,15 +364,171 @@ static int writeUint64(FILE *file, uint64_t u) {
 	return (fwrite(&u, sizeof(u), 1, file) ? 0 : -1);
 }
 
-int uiSave(void) {
+static int saveWrite(FILE *file) {
 	return 0
+		|| writeUint64(file, Signatures[9])
+		|| writeUint64(file, self.pos)
+		|| windowSave(file)
+		|| inputSave(file)
+		|| urlSave(file);
+}
+
+static int saveReplace(const char *buf, size_t len) {
+	int error = 0
+		|| fflush(saveFile)
 		|| ftruncate(fileno(saveFile), 0)
-		|| writeUint64(saveFile, Signatures[8])
-		|| writeUint64(saveFile, self.pos)
-		|| windowSave(saveFile)
-		|| inputSave(saveFile)
-		|| urlSave(saveFile)
+		|| (len && !fwrite(buf, len, 1, saveFile))
+		|| fflush(saveFile)
+		|| fsync(fileno(saveFile));
+	if (!error) saveSize = len;
+	return error;
+}
+
+// Changes since the save file was written are appended to a journal in
+// checksummed batches, and folded back into the save file once the journal
+// outgrows it. The new save file is written whole to the journal first, so
+// that it can be recovered if rewriting the save file is interrupted.
+enum { JournalBatch = 1, JournalSave };
+enum { JournalHead = 3 * sizeof(uint64_t), JournalMin = 1 << 20 };
+
+uint uiJournalInterval = 1000;
+bool uiJournalSync;
+
+static struct {
+	FILE *file;
+	off_t size;
+	struct timespec time;
+	char name[PATH_MAX];
+} journal;
+
+static uint64_t journalSum(uint64_t type, const char *ptr, uint64_t len) {
+	uint64_t hash = sum(SumInit, &type, sizeof(type));
+	hash = sum(hash, &len, sizeof(len));
+	return sum(hash, ptr, len);
+}
+
+static int journalWrite(uint64_t type, const char *ptr, size_t len) {
+	int error = 0
+		|| writeUint64(journal.file, type)
+		|| writeUint64(journal.file, len)
+		|| writeUint64(journal.file, journalSum(type, ptr, len))
+		|| (len && !fwrite(ptr, len, 1, journal.file))
+		|| fflush(journal.file);
+	if (!error) journal.size += JournalHead + len;
+	return error;
+}
+
+static int journalBatch(void) {
+	char *buf = NULL;
+	size_t len = 0;
+	FILE *file = open_memstream(&buf, &len);
+	if (!file) err(1, "open_memstream");
+	int error = 0
+		|| writeUint64(file, self.pos)
+		|| windowJournal(file)
+		|| inputJournal(file)
+		|| urlJournal(file);
+	error = fclose(file) || error
+		|| journalWrite(JournalBatch, buf, len)
+		|| (uiJournalSync && fsync(fileno(journal.file)));
+	free(buf);
+	return error;
+}
+
+// The save file is rewritten in a thread, so the main loop carries on while
+// it is synced. Batches wait until it is done and the journal is truncated.
+enum { CompactPoll = 10 };
+
+static struct {
+	pthread_t thread;
+	bool running;
+	atomic_bool done;
+	int error;
+	char *buf;
+	size_t len;
+} compact;
+
+static void *compactWrite(void *arg) {
+	(void)arg;
+	int error = 0
+		|| fsync(fileno(journal.file))
+		|| saveReplace(compact.buf, compact.len);
+	compact.error = (error ? errno : 0);
+	atomic_store(&compact.done, true);
+	return NULL;
+}
+
+static void compactStart(void) {
+	windowUnmap();
+	compact.buf = NULL;
+	compact.len = 0;
+	FILE *file = open_memstream(&compact.buf, &compact.len);
+	if (!file) err(1, "open_memstream");
+	int error = saveWrite(file);
+	error = fclose(file) || error;
+	if (error) err(1, "open_memstream");
+	error = journalWrite(JournalSave, compact.buf, compact.len);
+	if (error) err(1, "%s", journal.name);
+
+	sigset_t mask, prev;
+	sigfillset(&mask);
+	pthread_sigmask(SIG_SETMASK, &mask, &prev);
+	atomic_store(&compact.done, false);
+	error = pthread_create(&compact.thread, NULL, compactWrite, NULL);
+	pthread_sigmask(SIG_SETMASK, &prev, NULL);
+	if (error) {
+		errno = error;
+		err(1, "pthread_create");
+	}
+	compact.running = true;
+}
+
+static void compactEnd(void) {
+	pthread_join(compact.thread, NULL);
+	compact.running = false;
+	free(compact.buf);
+	if (compact.error) {
+		errno = compact.error;
+		err(1, "%s", journal.name);
+	}
+	int error = ftruncate(fileno(journal.file), 0);
+	if (error) err(1, "%s", journal.name);
+	journal.size = 0;
+}
+
+// Write a batch if anything has changed and the interval has passed since
+// the last, otherwise return the poll(2) timeout until it will have.
+int uiJournal(void) {
+	if (!journal.file) return -1;
+	if (compact.running) {
+		if (!atomic_load(&compact.done)) return CompactPoll;
+		compactEnd();
+	}
+	if (!windowChanged() && !urlChanged() && !inputChanged()) return -1;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	long elapsed = (ts.tv_sec - journal.time.tv_sec) * 1000
+		+ (ts.tv_nsec - journal.time.tv_nsec) / 1000000;
+	long interval = uiJournalInterval;
+	if (elapsed >= 0 && elapsed < interval) return interval - elapsed;
+	journal.time = ts;
+	int error = journalBatch();
+	if (error) err(1, "%s", journal.name);
+	if (journal.size < JournalMin || journal.size < saveSize) return -1;
+	compactStart();
+	return CompactPoll;
+}
+
+// Only the last changes are written at exit, so it doesn't wait on the
+// whole save file being rewritten, unless that had already begun.
+int uiSave(void) {
+	if (compact.running) compactEnd();
+	int error = 0
+		|| journalBatch()
+		|| fclose(journal.file)
 		|| fclose(saveFile);
+	journal.file = NULL;
+	return error;
 }
 
 static uint64_t readUint64(FILE *file) {
@@ -321,16 +539,80 @@ static uint64_t readUint64(FILE *file) {
 	return u;
 }
 
+static void journalReplay(const char *buf, size_t len) {
+	FILE *file = fmemopen((char *)buf, len, "r");
+	if (!file) err(1, "fmemopen");
+	self.pos = readUint64(file);
+	windowReplay(file);
+	inputLoad(file, ARRAY_LEN(Signatures) - 1);
+	urlLoad(file, ARRAY_LEN(Signatures) - 1);
+	fclose(file);
+}
+
+// Read the journal up to any torn batch at its end. If it holds a save file,
+// compaction was interrupted, so restore that before the save file is read.
+static char *journalRead(size_t *len, size_t *from) {
+	int error = fseeko(journal.file, 0, SEEK_END);
+	if (error) err(1, "%s", journal.name);
+	off_t size = ftello(journal.file);
+	if (size < 0) err(1, "%s", journal.name);
+	rewind(journal.file);
+	char *buf = malloc(size ?: 1);
+	if (!buf) err(1, "malloc");
+	if (size && !fread(buf, size, 1, journal.file)) {
+		err(1, "%s", journal.name);
+	}
+
+	size_t pos = 0, save = SIZE_MAX;
+	while ((size_t)size - pos >= JournalHead) {
+		uint64_t head[3];
+		memcpy(head, &buf[pos], sizeof(head));
+		if (head[1] > (size_t)size - pos - JournalHead) break;
+		if (journalSum(head[0], &buf[pos + JournalHead], head[1]) != head[2]) {
+			break;
+		}
+		if (head[0] == JournalSave) save = pos;
+		pos += JournalHead + head[1];
+	}
+	*len = pos;
+	*from = 0;
+	if (pos < (size_t)size) {
+		error = ftruncate(fileno(journal.file), pos);
+		if (error) err(1, "%s", journal.name);
+	}
+	journal.size = pos;
+	if (save == SIZE_MAX) return buf;
+
+	uint64_t head[3];
+	memcpy(head, &buf[save], sizeof(head));
+	error = saveReplace(&buf[save + JournalHead], head[1]);
+	if (error) err(1, "save file");
+	*from = save + JournalHead + head[1];
+	if (*from == pos) {
+		error = ftruncate(fileno(journal.file), 0);
+		if (error) err(1, "%s", journal.name);
+		journal.size = 0;
+	}
+	return buf;
+}
+
 void uiLoad(const char *name) {
 	int error;
 	saveFile = dataOpen(name, "a+e");
 	if (!saveFile) exit(1);
+	snprintf(journal.name, sizeof(journal.name), "%s.journal", name);
+	journal.file = dataOpen(journal.name, "a+e");
+	if (!journal.file) exit(1);
 	rewind(saveFile);
 
 #ifdef __FreeBSD__
 	cap_rights_t rights;
-	cap_rights_init(&rights, CAP_READ, CAP_WRITE, CAP_FLOCK, CAP_FTRUNCATE);
-	error = caph_rights_limit(fileno(saveFile), &rights);
+	cap_rights_init(
+		&rights, CAP_READ, CAP_WRITE, CAP_SEEK, CAP_FLOCK, CAP_FTRUNCATE,
+		CAP_FSYNC, CAP_FSTAT, CAP_MMAP_R
+	);
+	error = caph_rights_limit(fileno(saveFile), &rights)
+		|| caph_rights_limit(fileno(journal.file), &rights);
 	if (error) err(1, "cap_rights_limit");
 #endif
 
@@ -339,18 +621,33 @@ void uiLoad(const char *name) {
 		errx(1, "%s: save file in use", name);
 	}
 
+	size_t len, pos;
+	char *buf = journalRead(&len, &pos);
+	rewind(saveFile);
+	struct stat st;
+	error = fstat(fileno(saveFile), &st);
+	if (error) err(1, "fstat");
+	saveSize = st.st_size;
+
 	time_t signature;
 	fread(&signature, sizeof(signature), 1, saveFile);
 	if (ferror(saveFile)) err(1, "fread");
-	if (feof(saveFile)) {
-		return;
+	if (!feof(saveFile)) {
+		size_t version = signatureVersion(signature);
+		if (version > 1) {
+			self.pos = readUint64(saveFile);
+		}
+		windowLoad(saveFile, version);
+		inputLoad(saveFile, version);
+		urlLoad(saveFile, version);
 	}
-	size_t version = signatureVersion(signature);
 
-	if (version > 1) {
-		self.pos = readUint64(saveFile);
+	while (pos < len) {
+		uint64_t head[3];
+		memcpy(head, &buf[pos], sizeof(head));
+		pos += JournalHead;
+		if (head[0] == JournalBatch) journalReplay(&buf[pos], head[1]);
+		pos += head[1];
 	}
-	windowLoad(saveFile, version);
-	inputLoad(saveFile, version);
-	urlLoad(saveFile, version);
+	free(buf);
 }
@@ -25,89 +25,300 @@
  * covered work.
  */
 
+#include <ctype.h>
 #include <err.h>
 #include <errno.h>
 #include <limits.h>
-#include <regex.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <wchar.h>
+#include <wctype.h>
 
 #include "chat.h"
 
-static const char *Pattern = {
-	"("
-	"cvs|"
-	"ftp|"
-	"gemini|"
-	"git|"
-	"gopher|"
-	"http|"
-	"https|"
-	"irc|"
-	"ircs|"
-	"magnet|"
-	"sftp|"
-	"ssh|"
-	"svn|"
-	"telnet|"
-	"vnc"
-	")"
-	":([^[:space:]>\"()]|[(][^)]*[)])+"
+// URLs are found by their colons. The scheme before the colon is the
+// longest in the table, and what follows it is any run of characters other
+// than spaces and >"(), along with whole pairs of parentheses.
+static const struct Scheme {
+	const char *str;
+	size_t len;
+} Schemes[] = {
+#define X(str) { str, sizeof(str) - 1 }
+	X("cvs"),
+	X("ftp"),
+	X("gemini"),
+	X("git"),
+	X("gopher"),
+	X("http"),
+	X("https"),
+	X("irc"),
+	X("ircs"),
+	X("magnet"),
+	X("sftp"),
+	X("ssh"),
+	X("svn"),
+	X("telnet"),
+	X("vnc"),
+#undef X
 };
-static regex_t Regex;
 
-static void compile(void) {
-	static bool compiled;
-	if (compiled) return;
-	compiled = true;
-	int error = regcomp(&Regex, Pattern, REG_EXTENDED);
-	if (!error) return;
-	char buf[256];
-	regerror(error, &Regex, buf, sizeof(buf));
-	errx(1, "regcomp: %s: %s", buf, Pattern);
+static const bool Stop[128] = {
+	['\t'] = true, ['\n'] = true, ['\v'] = true, ['\f'] = true, ['\r'] = true,
+	[' '] = true, ['"'] = true, ['('] = true, [')'] = true, ['>'] = true,
+};
+
+static size_t schemeLen(const char *start, const char *colon) {
+	size_t len = 0;
+	for (size_t i = 0; i < ARRAY_LEN(Schemes); ++i) {
+		const struct Scheme *scheme = &Schemes[i];
+		if (scheme->len <= len || (size_t)(colon - start) < scheme->len) {
+			continue;
+		}
+		if (scheme->str[scheme->len - 1] != colon[-1]) continue;
+		if (!memcmp(colon - scheme->len, scheme->str, scheme->len)) {
+			len = scheme->len;
+		}
+	}
+	return len;
+}
+
+static size_t bodyLen(const char *str) {
+	const char *ptr = str;
+	for (;;) {
+		byte ch = *ptr;
+		if (ch == '(') {
+			const char *close = strchr(&ptr[1], ')');
+			if (!close) break;
+			ptr = &close[1];
+		} else if (ch < 0x80) {
+			if (!ch || Stop[ch]) break;
+			ptr++;
+		} else if (MB_CUR_MAX == 1) {
+			if (isspace(ch)) break;
+			ptr++;
+		} else {
+			// Spaces beyond ASCII depend on the locale.
+			wchar_t wc;
+			size_t len = mbrtowc(&wc, ptr, MB_CUR_MAX, &(mbstate_t) {0});
+			if (len == (size_t)-1 || len == (size_t)-2) {
+				len = 1;
+			} else if (iswspace(wc)) {
+				break;
+			}
+			ptr += len;
+		}
+	}
+	return ptr - str;
 }
 
+// Each window keeps its most recent URLs in a list, newest first. A URL
+// posted again moves to the front rather than taking another entry. Hash
+// tables find entries by URL and the newest entry from each nick, whose
+// entries are linked together in their own list.
 struct URL {
-	uint id;
+	struct URL *prev, *next;
+	struct URL *chain;
+	struct URL *nickPrev, *nickNext;
+	struct URL *nickChain;
+	uint64_t hash;
+	uint64_t nickHash;
+	size_t seq;
 	char *nick;
 	char *url;
 };
 
-enum { Cap = 64 };
-static struct {
-	struct URL urls[Cap];
+static struct List {
+	struct URL *head, *tail;
 	size_t len;
-} ring;
-_Static_assert(!(Cap & (Cap - 1)), "Cap is power of two");
+	size_t cap;
+	struct URL **urls;
+	struct URL **nicks;
+} lists[IDCap];
 
-static void push(uint id, const char *nick, const char *str, size_t len) {
-	struct URL *url = &ring.urls[ring.len++ % Cap];
+uint urlDepth = 64;
+struct URLStats urlStats;
+
+static size_t pushes;
+
+static uint64_t urlHash(const char *str) {
+	return sum(SumInit, str, strlen(str));
+}
+
+static struct URL **entryFind(
+	struct List *list, uint64_t hash, const char *str
+) {
+	struct URL **ptr = &list->urls[hash & (list->cap - 1)];
+	for (; *ptr; ptr = &(*ptr)->chain) {
+		if ((*ptr)->hash == hash && !strcmp((*ptr)->url, str)) break;
+	}
+	return ptr;
+}
+
+static struct URL **nickFind(
+	struct List *list, uint64_t hash, const char *nick
+) {
+	struct URL **ptr = &list->nicks[hash & (list->cap - 1)];
+	for (; *ptr; ptr = &(*ptr)->nickChain) {
+		if ((*ptr)->nickHash == hash && !strcmp((*ptr)->nick, nick)) break;
+	}
+	return ptr;
+}
+
+// The tables double as the list grows, so a large depth costs nothing in a
+// window with few URLs.
+enum { ListMin = 16 };
+
+static void listGrow(struct List *list) {
+	size_t cap = (list->cap ? 2 * list->cap : ListMin);
+	struct URL **urls = calloc(cap, sizeof(*urls));
+	struct URL **nicks = calloc(cap, sizeof(*nicks));
+	if (!urls || !nicks) err(1, "calloc");
+	for (struct URL *url = list->head; url; url = url->next) {
+		struct URL **ptr = &urls[url->hash & (cap - 1)];
+		url->chain = *ptr;
+		*ptr = url;
+		if (!url->nick || url->nickPrev) continue;
+		ptr = &nicks[url->nickHash & (cap - 1)];
+		url->nickChain = *ptr;
+		*ptr = url;
+	}
+	free(list->urls);
+	free(list->nicks);
+	if (!list->cap) urlStats.lists++;
+	urlStats.bytes += 2 * (cap - list->cap) * sizeof(*urls);
+	list->urls = urls;
+	list->nicks = nicks;
+	list->cap = cap;
+}
+
+static void listUnlink(struct List *list, struct URL *url) {
+	if (url->prev) url->prev->next = url->next;
+	if (url->next) url->next->prev = url->prev;
+	if (list->head == url) list->head = url->next;
+	if (list->tail == url) list->tail = url->prev;
+	*entryFind(list, url->hash, url->url) = url->chain;
+	if (!url->nick) return;
+
+	if (url->nickPrev) {
+		url->nickPrev->nickNext = url->nickNext;
+	} else {
+		struct URL **ptr = nickFind(list, url->nickHash, url->nick);
+		if (url->nickNext) {
+			url->nickNext->nickChain = url->nickChain;
+			*ptr = url->nickNext;
+		} else {
+			*ptr = url->nickChain;
+		}
+	}
+	if (url->nickNext) url->nickNext->nickPrev = url->nickPrev;
+}
+
+static void listLink(struct List *list, struct URL *url) {
+	url->prev = NULL;
+	url->next = list->head;
+	if (list->head) list->head->prev = url;
+	list->head = url;
+	if (!list->tail) list->tail = url;
+	struct URL **ptr = entryFind(list, url->hash, url->url);
+	url->chain = NULL;
+	*ptr = url;
+	url->nickPrev = url->nickNext = url->nickChain = NULL;
+	if (!url->nick) return;
+
+	ptr = nickFind(list, url->nickHash, url->nick);
+	if (*ptr) {
+		url->nickNext = *ptr;
+		url->nickChain = (*ptr)->nickChain;
+		(*ptr)->nickPrev = url;
+		(*ptr)->nickChain = NULL;
+	}
+	*ptr = url;
+}
+
+static size_t urlSize(const struct URL *url) {
+	return sizeof(*url) + strlen(url->url) + 1
+		+ (url->nick ? strlen(url->nick) + 1 : 0);
+}
+
+static void urlFree(struct URL *url) {
+	urlStats.urls--;
+	urlStats.bytes -= urlSize(url);
 	free(url->nick);
 	free(url->url);
+	free(url);
+}
+
+static void push(uint id, const char *nick, const char *str, size_t len) {
+	char *text = malloc(len + 1);
+	if (!text) err(1, "malloc");
+	memcpy(text, str, len);
+	text[len] = '\0';
+
+	// Most URLs have no formatting to strip.
+	if (strcspn(text, (const char[]) { B, C, O, R, I, U, '\0' }) < len) {
+		char *buf = strdup(text);
+		if (!buf) err(1, "strdup");
+		styleStrip(text, len + 1, buf);
+		free(buf);
+	}
+
+	struct List *list = &lists[id];
+	if (list->len >= list->cap && list->len < urlDepth) listGrow(list);
+	uint64_t hash = urlHash(text);
+	struct URL *url = *entryFind(list, hash, text);
+	if (url) {
+		free(text);
+		listUnlink(list, url);
+		urlStats.bytes -= urlSize(url);
+		free(url->nick);
+		urlStats.repeats++;
+	} else {
+		while (list->len >= urlDepth) {
+			struct URL *tail = list->tail;
+			listUnlink(list, tail);
+			urlFree(tail);
+			list->len--;
+		}
+		url = calloc(1, sizeof(*url));
+		if (!url) err(1, "calloc");
+		url->hash = hash;
+		url->url = text;
+		list->len++;
+		urlStats.urls++;
+	}
 
-	url->id = id;
 	url->nick = NULL;
 	if (nick) {
 		url->nick = strdup(nick);
 		if (!url->nick) err(1, "strdup");
+		url->nickHash = urlHash(nick);
 	}
-	url->url = malloc(len + 1);
-	if (!url->url) err(1, "malloc");
+	url->seq = ++pushes;
+	urlStats.bytes += urlSize(url);
+	listLink(list, url);
+}
 
-	char buf[1024];
-	snprintf(buf, sizeof(buf), "%.*s", (int)len, str);
-	styleStrip(url->url, len + 1, buf);
+// Return the start of the first URL in str, setting its length.
+static const char *urlFind(const char *str, size_t *len) {
+	for (const char *ptr = str, *colon; (colon = strchr(ptr, ':'));) {
+		ptr = &colon[1];
+		size_t scheme = schemeLen(str, colon);
+		if (!scheme) continue;
+		size_t body = bodyLen(&colon[1]);
+		if (!body) continue;
+		*len = scheme + 1 + body;
+		return colon - scheme;
+	}
+	return NULL;
 }
 
 void urlScan(uint id, const char *nick, const char *mesg) {
-	if (!mesg) return;
-	compile();
-	regmatch_t match = {0};
-	for (const char *ptr = mesg; *ptr; ptr += match.rm_eo) {
-		if (regexec(&Regex, ptr, 1, &match, 0)) break;
-		push(id, nick, &ptr[match.rm_so], match.rm_eo - match.rm_so);
+	if (!mesg || !urlDepth) return;
+	size_t len;
+	for (const char *ptr = mesg; (ptr = urlFind(ptr, &len)); ptr += len) {
+		push(id, nick, ptr, len);
 	}
 }
 
@@ -196,41 +407,32 @@ static void urlCopy(const char *url) {
 }
 
 void urlOpenCount(uint id, uint count) {
-	for (uint i = 1; i <= Cap; ++i) {
-		const struct URL *url = &ring.urls[(ring.len - i) % Cap];
-		if (!url->url) break;
-		if (url->id != id) continue;
+	for (const struct URL *url = lists[id].head; url; url = url->next) {
 		urlOpen(url->url);
 		if (!--count) break;
 	}
 }
 
-void urlOpenMatch(uint id, const char *str) {
-	for (uint i = 1; i <= Cap; ++i) {
-		const struct URL *url = &ring.urls[(ring.len - i) % Cap];
-		if (!url->url) break;
-		if (url->id != id) continue;
-		if ((url->nick && !strcmp(url->nick, str)) || strstr(url->url, str)) {
-			urlOpen(url->url);
-			break;
-		}
+// Return the newest URL from nick str or containing str. Only URLs newer
+// than the newest from the nick need to be searched.
+static const struct URL *urlMatch(uint id, const char *str) {
+	struct List *list = &lists[id];
+	if (!list->cap) return NULL;
+	const struct URL *from = *nickFind(list, urlHash(str), str);
+	for (const struct URL *url = list->head; url != from; url = url->next) {
+		if (strstr(url->url, str)) return url;
 	}
+	return from;
+}
+
+void urlOpenMatch(uint id, const char *str) {
+	const struct URL *url = urlMatch(id, str);
+	if (url) urlOpen(url->url);
 }
 
 void urlCopyMatch(uint id, const char *str) {
-	for (uint i = 1; i <= Cap; ++i) {
-		const struct URL *url = &ring.urls[(ring.len - i) % Cap];
-		if (!url->url) break;
-		if (url->id != id) continue;
-		if (
-			!str
-			|| (url->nick && !strcmp(url->nick, str))
-			|| strstr(url->url, str)
-		) {
-			urlCopy(url->url);
-			break;
-		}
-	}
+	const struct URL *url = (str ? urlMatch(id, str) : lists[id].head);
+	if (url) urlCopy(url->url);
 }
 
 static int writeString(FILE *file, const char *str) {
@@ -242,37 +444,298 @@ static ssize_t readString(FILE *file, char **buf, size_t *cap) {
 	return len;
 }
 
+static int writeURL(FILE *file, uint id, const struct URL *url) {
+	return 0
+		|| writeString(file, idNames[id])
+		|| writeString(file, (url->nick ?: ""))
+		|| writeString(file, url->url);
+}
+
+// Each window's URLs are written oldest first, so that loading them pushes
+// them back in the same order.
 int urlSave(FILE *file) {
-	for (size_t i = 0; i < Cap; ++i) {
-		const struct URL *url = &ring.urls[(ring.len + i) % Cap];
-		if (!url->url) continue;
-		int error = 0
-			|| writeString(file, idNames[url->id])
-			|| writeString(file, (url->nick ?: ""))
-			|| writeString(file, url->url);
-		if (error) return error;
+	for (uint id = 0; id < IDCap; ++id) {
+		for (const struct URL *url = lists[id].tail; url; url = url->prev) {
+			int error = writeURL(file, id, url);
+			if (error) return error;
+		}
 	}
 	return writeString(file, "");
 }
 
+static size_t journaled;
+
+bool urlChanged(void) {
+	return pushes != journaled;
+}
+
+// Write the URLs pushed since the last call, in the urlSave() format.
+int urlJournal(FILE *file) {
+	for (uint id = 0; id < IDCap; ++id) {
+		const struct URL *from = NULL;
+		for (const struct URL *url = lists[id].head; url; url = url->next) {
+			if (url->seq <= journaled) break;
+			from = url;
+		}
+		for (const struct URL *url = from; url; url = url->prev) {
+			int error = writeURL(file, id, url);
+			if (error) return error;
+		}
+	}
+	journaled = pushes;
+	return writeString(file, "");
+}
+
 void urlLoad(FILE *file, size_t version) {
 	if (version < 5) return;
 	size_t cap = 0;
 	char *buf = NULL;
+	char *nick = NULL;
 	while (0 < readString(file, &buf, &cap) && buf[0]) {
-		struct URL *url = &ring.urls[ring.len++ % Cap];
-		free(url->nick);
-		free(url->url);
-		url->id = idFor(buf);
-		url->nick = NULL;
+		uint id = idFor(buf);
 		readString(file, &buf, &cap);
-		if (buf[0]) {
-			url->nick = strdup(buf);
-			if (!url->nick) err(1, "strdup");
-		}
-		readString(file, &buf, &cap);
-		url->url = strdup(buf);
-		if (!url->url) err(1, "strdup");
+		free(nick);
+		nick = (buf[0] ? strdup(buf) : NULL);
+		if (buf[0] && !nick) err(1, "strdup");
+		ssize_t len = readString(file, &buf, &cap);
+		if (len < 0 || !urlDepth) continue;
+		push(id, nick, buf, strlen(buf));
+	}
+	free(nick);
+	free(buf);
+	journaled = pushes;
+}
+
+#if defined(TEST) || defined(BENCH)
+#include <locale.h>
+#include <regex.h>
+
+char *idNames[IDCap];
+enum Color idColors[IDCap];
+uint idNext;
+int utilPipe[2] = { -1, -1 };
+
+// The pattern urlFind() replaced, to check it against.
+static const char *Pattern = {
+	"("
+	"cvs|"
+	"ftp|"
+	"gemini|"
+	"git|"
+	"gopher|"
+	"http|"
+	"https|"
+	"irc|"
+	"ircs|"
+	"magnet|"
+	"sftp|"
+	"ssh|"
+	"svn|"
+	"telnet|"
+	"vnc"
+	")"
+	":([^[:space:]>\"()]|[(][^)]*[)])+"
+};
+static regex_t Regex;
+
+static const char *regexFind(const char *str, size_t *len) {
+	regmatch_t match;
+	if (regexec(&Regex, str, 1, &match, 0)) return NULL;
+	*len = match.rm_eo - match.rm_so;
+	return &str[match.rm_so];
+}
+#endif
+
+#ifdef TEST
+#undef NDEBUG
+#include <assert.h>
+
+static void same(const char *str) {
+	const char *a = str, *b = str;
+	size_t alen = 0, blen = 0;
+	for (;;) {
+		a = regexFind(a, &alen);
+		b = urlFind(b, &blen);
+		assert(a == b);
+		if (!a) break;
+		assert(alen == blen);
+		a += alen;
+		b += blen;
 	}
+}
+
+static void match(uint id, const char *str, const char *url) {
+	const struct URL *found = urlMatch(id, str);
+	assert(url ? found && !strcmp(found->url, url) : !found);
+}
+
+static void saved(int (*save)(FILE *), const char *expect, size_t len) {
+	char *buf = NULL;
+	size_t size = 0;
+	FILE *file = open_memstream(&buf, &size);
+	assert(file);
+	assert(!save(file));
+	fclose(file);
+	assert(size == len && !memcmp(buf, expect, len));
 	free(buf);
 }
+
+int main(void) {
+	setlocale(LC_CTYPE, "");
+	int error = regcomp(&Regex, Pattern, REG_EXTENDED);
+	assert(!error);
+
+	const char *strs[] = {
+		"",
+		"no urls here: none",
+		"http://example.org",
+		"see <https://example.org/a?b=c&d> now",
+		"\"ftp://example.org/file\" and sftp://host/file",
+		"https://en.wikipedia.org/wiki/Foo_(bar) and (http://x.y/z)",
+		"http://a(b(c)d)e http://a(b http://a)b",
+		"xhttps://example.org xssh:host sshttp:x",
+		"http: https:// irc:/ ircs:#chan gemini://x gopher://y",
+		"magnet:?xt=urn:btih:abc telnet://h vnc://h cvs:x svn:y git:z",
+		"http:\3" "04red\3http://b.c\2bold\2",
+		"http://\xC3\xA9t\xC3\xA9 https://a\xE3\x80\x80" "b",
+		"http://a\tb http://c\vd http://e\rf",
+		"::::http::::https:::",
+	};
+	for (size_t i = 0; i < ARRAY_LEN(strs); ++i) {
+		same(strs[i]);
+	}
+
+	const char *parts[] = {
+		"http", "https", "irc", "ircs", "sftp", "ftp", "ssh", "s", "x",
+		":", "//", "(", ")", " ", ">", "\"", "\3" "04", "\xC3\xA9",
+		"\xE3\x80\x80", "\xFF", ".", "/", "a",
+	};
+	srand(1);
+	for (int i = 0; i < 100000; ++i) {
+		char str[256] = "";
+		for (int j = rand() % 24; j; --j) {
+			strcat(str, parts[rand() % ARRAY_LEN(parts)]);
+		}
+		same(str);
+	}
+
+	urlDepth = 3;
+	idNames[Network] = "#a";
+	urlScan(Network, "a", "http://1 and http://2");
+	urlScan(Network, "a", "http://3");
+	match(Network, "a", "http://3");
+	match(Network, "2", "http://2");
+	urlScan(Network, "b", "http://1");
+	match(Network, "a", "http://3");
+	match(Network, "b", "http://1");
+	match(Network, "http", "http://1");
+	assert(urlStats.urls == 3 && urlStats.repeats == 1);
+
+	journaled = pushes;
+	urlScan(Network, "c", "\2http://4\2 http://5");
+	match(Network, "a", NULL);
+	match(Network, "b", "http://1");
+	match(Network, "c", "http://5");
+	match(Debug, "c", NULL);
+	assert(urlStats.urls == 3);
+	saved(urlJournal, "#a\0c\0http://4\0#a\0c\0http://5\0", 29);
+	saved(
+		urlSave, "#a\0b\0http://1\0#a\0c\0http://4\0#a\0c\0http://5\0", 43
+	);
+}
+
+#endif /* TEST */
+
+#ifdef BENCH
+#include <inttypes.h>
+#include <time.h>
+
+static uint64_t nsec(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static const char *Traffic[] = {
+	"june: did you see the build broke again after the last merge?",
+	"yeah, somebody pushed to master without running the tests :(",
+	"see https://example.org/ci/builds/12345 for the logs",
+	"\1ACTION hides the big red button\1",
+	"nyaa~ good morning everyone",
+	"time for lunch, back in 20: don't break anything",
+	"https://en.wikipedia.org/wiki/Foo_(bar) is relevant here",
+	"ok: the fix is in, ssh to the box and git pull",
+	"lol",
+	"\3" "04!!\3 new release at https://git.example.org/foo/refs/v1.2",
+	"does anyone know how to make irc://irc.example.org/#chan open?",
+	"10:42 <bot> title: Some Page Title | Example",
+};
+
+static size_t count(
+	const char *(*find)(const char *, size_t *), const char **strs, size_t n
+) {
+	size_t urls = 0, len;
+	for (size_t i = 0; i < n; ++i) {
+		for (const char *ptr = strs[i]; (ptr = find(ptr, &len)); ptr += len) {
+			urls++;
+		}
+	}
+	return urls;
+}
+
+// Lines are read from the files given, such as logs, or else made up.
+int main(int argc, char *argv[]) {
+	setlocale(LC_CTYPE, "");
+	int error = regcomp(&Regex, Pattern, REG_EXTENDED);
+	if (error) errx(1, "regcomp");
+
+	const char **strs = Traffic;
+	size_t n = ARRAY_LEN(Traffic);
+	if (argc > 1) {
+		size_t cap = 0;
+		strs = NULL;
+		n = 0;
+		for (int i = 1; i < argc; ++i) {
+			FILE *file = fopen(argv[i], "r");
+			if (!file) err(1, "%s", argv[i]);
+			char *line = NULL;
+			size_t size = 0;
+			for (ssize_t len; 0 < (len = getline(&line, &size, file));) {
+				if (line[len - 1] == '\n') line[len - 1] = '\0';
+				if (n == cap) {
+					cap = (cap ? cap * 2 : 1024);
+					strs = realloc(strs, sizeof(*strs) * cap);
+					if (!strs) err(1, "realloc");
+				}
+				strs[n] = strdup(line);
+				if (!strs[n++]) err(1, "strdup");
+			}
+			free(line);
+			fclose(file);
+		}
+		if (!n) errx(1, "no lines");
+	}
+
+	enum { Lines = 1000000 };
+	size_t rounds = (Lines + n - 1) / n;
+	uint64_t start = nsec();
+	size_t urls = 0;
+	for (size_t i = 0; i < rounds; ++i) {
+		urls += count(regexFind, strs, n);
+	}
+	uint64_t regex = nsec() - start;
+	start = nsec();
+	for (size_t i = 0; i < rounds; ++i) {
+		urls -= count(urlFind, strs, n);
+	}
+	uint64_t find = nsec() - start;
+	if (urls) errx(1, "urlFind disagrees with regexec");
+
+	printf(
+		"%zu lines  regexec %5" PRIu64 " ns/line  urlFind %5" PRIu64
+		" ns/line\n",
+		n, regex / (rounds * n), find / (rounds * n)
+	);
+}
+
+#endif /* BENCH */
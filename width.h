@@ -0,0 +1,1176 @@
+// Generated by scripts/width.awk from Unicode 14.0.0.
+// Do not edit.
+
+#include <wchar.h>
+
+static const unsigned char WidthBlocks[0x110000 >> 8] = {
+	0, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 1, 1, 19, 20, 21, 22, 23, 24, 25, 26, 1, 27,
+	28, 29, 1, 30, 31, 32, 33, 34, 1, 1, 1, 35, 36, 37, 38, 39,
+	40, 41, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 44, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 45, 1, 46, 47, 48, 49, 50, 51, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 52, 53, 53, 53, 53, 53, 53, 53, 53,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 43, 54, 55, 1, 56, 57, 58,
+	59, 60, 61, 62, 63, 64, 1, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+	74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 53, 85, 86, 87, 88,
+	1, 1, 1, 89, 90, 91, 53, 53, 53, 53, 53, 53, 53, 53, 53, 92,
+	1, 1, 1, 1, 93, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 1, 1, 94, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 1, 1, 95, 96, 53, 53, 97, 98,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 99, 43, 43, 43, 43, 100, 101, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 102,
+	43, 103, 104, 53, 53, 53, 53, 53, 53, 53, 53, 53, 105, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 106,
+	107, 108, 109, 110, 111, 112, 113, 114, 1, 1, 115, 53, 53, 53, 53, 116,
+	117, 118, 119, 53, 53, 53, 53, 120, 121, 122, 53, 53, 123, 124, 125, 53,
+	126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 53, 53, 53, 53,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 138, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 139, 140, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 141, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 142, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 43, 43, 143, 53, 53, 53, 53, 53,
+	43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+	43, 43, 43, 144, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	145, 146, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 147,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 147,
+};
+
+static const unsigned char WidthCells[][64] = {
+	{
+		1, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 170, 170, 160, 170,
+		0, 170, 42, 162, 170, 170, 170, 170, 138, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		106, 85, 165, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 168, 170, 170, 170,
+		170, 170, 170, 170, 170, 42, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 42, 168, 84, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 101,
+		150, 101, 0, 0, 170, 170, 170, 170, 170, 170, 42, 128, 170, 2, 0, 0,
+	},
+	{
+		85, 165, 170, 170, 85, 85, 149, 169, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 106, 85, 85, 85, 85, 85, 170, 170, 170, 170, 169, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 90, 85, 101, 85, 105, 89, 165, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 74, 166, 170, 170, 170, 170, 170, 170, 170, 85, 85, 85, 85,
+		85, 85, 21, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 90, 85, 85, 9, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 85, 170, 42, 164,
+	},
+	{
+		170, 170, 170, 170, 170, 90, 101, 85, 85, 86, 86, 5, 170, 170, 170, 42,
+		170, 170, 170, 170, 170, 170, 86, 32, 170, 170, 42, 0, 170, 170, 170, 170,
+		170, 170, 170, 42, 5, 0, 85, 85, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 90, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+	},
+	{
+		149, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 154, 169,
+		86, 85, 169, 166, 86, 85, 170, 170, 90, 170, 170, 170, 170, 170, 170, 170,
+		166, 168, 170, 130, 130, 170, 170, 170, 170, 170, 162, 170, 34, 160, 10, 169,
+		86, 129, 130, 38, 0, 128, 0, 138, 90, 160, 170, 170, 170, 170, 170, 26,
+	},
+	{
+		148, 168, 42, 128, 130, 170, 170, 170, 170, 170, 162, 170, 162, 40, 10, 161,
+		22, 64, 65, 5, 4, 0, 168, 34, 0, 160, 170, 170, 165, 38, 0, 0,
+		148, 168, 170, 138, 138, 170, 170, 170, 170, 170, 162, 170, 162, 168, 10, 169,
+		86, 69, 137, 6, 2, 0, 0, 0, 90, 160, 170, 170, 10, 0, 88, 85,
+	},
+	{
+		164, 168, 170, 130, 130, 170, 170, 170, 170, 170, 162, 170, 162, 168, 10, 105,
+		86, 129, 130, 6, 0, 148, 0, 138, 90, 160, 170, 170, 170, 170, 0, 0,
+		144, 168, 42, 160, 162, 10, 40, 162, 128, 2, 42, 160, 170, 170, 10, 160,
+		41, 160, 162, 6, 2, 128, 0, 0, 0, 160, 170, 170, 170, 170, 42, 0,
+	},
+	{
+		169, 169, 170, 162, 162, 170, 170, 170, 170, 170, 162, 170, 170, 170, 10, 89,
+		169, 82, 81, 5, 0, 20, 42, 8, 90, 160, 170, 170, 0, 128, 170, 170,
+		166, 170, 170, 162, 162, 170, 170, 170, 170, 170, 162, 170, 170, 168, 10, 105,
+		170, 146, 162, 5, 0, 40, 0, 40, 90, 160, 170, 170, 40, 0, 0, 0,
+	},
+	{
+		165, 170, 170, 162, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 169,
+		86, 161, 162, 166, 0, 170, 170, 170, 90, 160, 170, 170, 170, 170, 170, 170,
+		164, 168, 170, 170, 170, 42, 160, 170, 170, 170, 170, 170, 138, 170, 170, 8,
+		170, 42, 16, 128, 90, 17, 170, 170, 0, 160, 170, 170, 160, 2, 0, 0,
+	},
+	{
+		168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 166, 85, 21, 128,
+		170, 106, 85, 149, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		40, 162, 42, 170, 170, 170, 170, 170, 170, 136, 170, 170, 166, 85, 85, 9,
+		170, 34, 85, 5, 170, 170, 10, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 165, 170, 170, 170, 170, 170, 170, 102, 166, 170,
+		170, 170, 168, 170, 170, 170, 170, 170, 170, 170, 170, 2, 84, 85, 85, 149,
+		85, 89, 170, 86, 85, 85, 84, 85, 85, 85, 85, 85, 85, 85, 85, 161,
+		170, 154, 170, 162, 170, 170, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 86, 89, 85, 150, 150,
+		170, 170, 170, 170, 170, 170, 165, 90, 169, 170, 170, 170, 86, 169, 170, 170,
+		154, 150, 170, 166, 170, 170, 170, 166, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 138, 0, 8, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 162, 10, 170, 42, 162, 10, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 162, 10, 170, 170, 170, 170, 170, 170, 170, 170, 162, 10, 170, 42,
+		162, 10, 170, 170, 170, 42, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 162, 10, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 42, 84, 170, 170, 170, 170, 170, 170, 170, 2,
+		170, 170, 170, 170, 170, 170, 10, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 170, 10,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 2, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 0,
+	},
+	{
+		170, 170, 170, 170, 90, 9, 0, 128, 170, 170, 170, 170, 90, 42, 0, 0,
+		170, 170, 170, 170, 90, 0, 0, 0, 170, 170, 170, 162, 82, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 101, 85, 165,
+		170, 154, 86, 85, 85, 170, 170, 6, 170, 170, 10, 0, 170, 170, 10, 0,
+	},
+	{
+		170, 170, 106, 85, 170, 170, 10, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 0,
+		170, 150, 170, 170, 170, 170, 170, 170, 170, 170, 38, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 42, 149, 106, 169, 0, 154, 170, 86, 0,
+		2, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 170, 2, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 170, 170, 170, 170,
+		170, 170, 10, 0, 170, 170, 42, 160, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 106, 105, 160, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 154, 85, 21, 153, 86, 85, 169, 106, 85, 85, 65,
+		170, 170, 10, 0, 170, 170, 10, 0, 170, 170, 170, 10, 85, 85, 85, 85,
+		85, 85, 85, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		85, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 89, 149, 169,
+		154, 170, 170, 2, 170, 170, 170, 170, 170, 170, 106, 85, 85, 170, 170, 42,
+		165, 170, 170, 170, 170, 170, 170, 170, 90, 165, 101, 165, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 154, 165, 102, 165, 0, 0, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 85, 90, 128, 170,
+		170, 170, 10, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 2, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 168,
+		170, 170, 0, 0, 149, 85, 85, 85, 89, 85, 169, 166, 170, 169, 37, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+	},
+	{
+		170, 170, 170, 170, 170, 10, 170, 10, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 10, 170, 10, 170, 170, 136, 136, 170, 170, 170, 170, 170, 170, 170, 10,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 162, 170, 170,
+		170, 162, 170, 170, 170, 160, 170, 168, 170, 170, 170, 170, 160, 162, 170, 42,
+	},
+	{
+		170, 170, 106, 85, 170, 170, 170, 170, 170, 170, 80, 149, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 85, 81, 85, 85, 10, 170, 170, 170,
+		170, 170, 170, 42, 170, 170, 170, 2, 170, 170, 170, 170, 170, 170, 170, 170,
+		2, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85, 1, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 250, 170, 170, 170, 190, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 254, 171, 235, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 0, 0, 0, 0,
+		170, 170, 42, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 190,
+	},
+	{
+		170, 170, 170, 170, 170, 175, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 255, 255, 255, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 234,
+		170, 170, 170, 170, 234, 170, 170, 170, 174, 170, 250, 170, 170, 170, 170, 190,
+		170, 175, 170, 186, 170, 171, 170, 170, 170, 170, 186, 170, 250, 174, 186, 174,
+	},
+	{
+		170, 174, 250, 170, 170, 170, 170, 170, 170, 170, 171, 170, 170, 170, 170, 170,
+		170, 170, 170, 187, 234, 239, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 254, 170, 170, 170, 170, 170, 170, 171, 170, 170, 234,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 234, 171, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 171, 174, 170, 170, 170, 170, 170, 170, 170, 160, 170, 170,
+		170, 170, 170, 170, 170, 138, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 165, 0, 168, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 138, 0, 8, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 128, 2, 0, 0, 64,
+		170, 170, 170, 170, 170, 42, 0, 0, 170, 42, 170, 42, 170, 42, 170, 42,
+		170, 42, 170, 42, 170, 42, 170, 42, 85, 85, 85, 85, 85, 85, 85, 85,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+		255, 255, 255, 255, 255, 255, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 15, 0, 0, 0, 0, 0, 0, 255, 255, 255, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 95, 245, 255, 255, 255, 191,
+		252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 63, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		0, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 63, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 170, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 63, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 149, 85, 85, 165,
+		170, 170, 170, 170, 170, 170, 170, 90, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 165, 170, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 42, 0, 138, 168, 10, 0, 0, 0, 0, 0, 160, 170, 170, 170,
+	},
+	{
+		154, 154, 106, 170, 170, 170, 170, 170, 170, 150, 170, 1, 170, 170, 10, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 5, 0, 160, 170, 170, 10, 0, 85, 85, 85, 85, 165, 170, 170, 106,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 90, 85, 165, 170, 170, 170, 170,
+		170, 106, 85, 85, 165, 0, 0, 128, 255, 255, 255, 255, 255, 255, 255, 3,
+		149, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 90, 165, 165,
+		170, 170, 170, 138, 170, 170, 10, 160, 170, 166, 170, 170, 170, 170, 170, 42,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 86, 149, 150, 22, 0, 0,
+		106, 170, 170, 9, 170, 170, 10, 170, 170, 170, 170, 170, 170, 170, 170, 169,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 89, 105, 169, 90,
+		38, 0, 0, 0, 0, 0, 128, 170, 170, 170, 170, 165, 170, 26, 0, 0,
+	},
+	{
+		168, 42, 168, 42, 168, 42, 0, 0, 170, 42, 170, 42, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 166, 169, 6, 170, 170, 10, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 170, 170, 170, 170,
+		170, 42, 128, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 15, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 42, 0, 0, 128, 170, 0, 152, 170, 170, 170, 170, 170, 42, 170, 34,
+		138, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		42, 0, 0, 0, 128, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 160, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170,
+	},
+	{
+		85, 85, 85, 85, 255, 255, 15, 0, 85, 85, 85, 85, 255, 255, 255, 255,
+		255, 255, 255, 255, 63, 255, 255, 255, 255, 63, 255, 0, 170, 162, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 66,
+	},
+	{
+		252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 171, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42,
+		160, 170, 160, 170, 160, 170, 160, 2, 255, 63, 170, 42, 0, 0, 84, 10,
+	},
+	{
+		170, 170, 170, 168, 170, 170, 170, 170, 170, 42, 170, 170, 170, 170, 42, 138,
+		170, 170, 170, 10, 170, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0,
+	},
+	{
+		42, 128, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 128, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 42, 170, 170, 170, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 6,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 2, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 2, 0, 0, 0, 169, 170, 170, 170, 170, 170, 170, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 168, 170, 170, 170, 170,
+		170, 170, 42, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 90, 21, 0,
+		170, 170, 170, 170, 170, 170, 170, 138, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 0, 170, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 10, 170, 170, 10, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 128, 170, 170, 42, 170,
+		170, 170, 42, 170, 42, 138, 170, 170, 138, 170, 170, 170, 138, 170, 138, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0,
+		170, 170, 170, 170, 170, 10, 0, 0, 170, 170, 0, 0, 0, 0, 0, 0,
+		170, 138, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 162, 170, 42, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 10, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 138, 2, 130,
+		170, 170, 170, 170, 170, 138, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 42, 0, 128, 170, 170, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 42, 10, 128, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 128, 170, 170, 170, 170, 170, 170, 10, 128,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 170,
+		170, 170, 170, 170, 160, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		86, 20, 0, 85, 170, 168, 168, 170, 170, 170, 170, 170, 170, 10, 21, 64,
+		170, 170, 2, 0, 170, 170, 2, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 22, 128, 170, 170, 42, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 168, 170,
+		170, 170, 170, 170, 170, 10, 170, 170, 170, 170, 170, 170, 42, 0, 170, 170,
+		170, 170, 170, 170, 10, 0, 168, 2, 0, 0, 168, 170, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 160, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 0, 0, 170, 170, 10, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 42,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 74, 9, 10, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 170, 170, 170, 170,
+		170, 90, 85, 85, 169, 170, 10, 0, 0, 0, 0, 0, 170, 170, 170, 170,
+		90, 165, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170,
+		170, 170, 170, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 42, 0, 0,
+	},
+	{
+		166, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 85,
+		85, 149, 170, 10, 160, 170, 170, 170, 170, 170, 170, 170, 105, 9, 0, 64,
+		165, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 149, 150, 166,
+		26, 0, 0, 4, 170, 170, 170, 170, 170, 170, 2, 0, 170, 170, 10, 0,
+	},
+	{
+		149, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 86, 85, 161, 170, 170,
+		170, 170, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 106, 42, 0, 0,
+		165, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 90, 85, 149,
+		170, 170, 86, 105, 170, 170, 170, 170, 168, 170, 170, 170, 170, 2, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 138, 170, 170, 170, 170, 170, 170, 106, 165, 89, 170, 26,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 42, 162, 138, 170, 170, 170, 138, 170, 170, 10, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 106, 106, 85, 21, 0, 170, 170, 10, 0,
+	},
+	{
+		165, 168, 170, 130, 130, 170, 170, 170, 170, 170, 162, 170, 162, 168, 74, 169,
+		169, 130, 130, 10, 2, 128, 0, 168, 170, 80, 85, 1, 85, 1, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 85,
+		90, 153, 170, 170, 170, 170, 170, 152, 10, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 153, 106,
+		89, 170, 0, 0, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 90, 5, 170, 101,
+		169, 170, 170, 170, 170, 170, 170, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 149, 102,
+		169, 2, 0, 0, 170, 170, 10, 0, 170, 170, 170, 2, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 166, 85, 101, 10, 0,
+		170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 42, 84, 90, 101, 85, 0, 170, 170, 170, 170,
+		170, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 85, 150, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 128,
+	},
+	{
+		170, 42, 8, 170, 170, 40, 170, 170, 170, 170, 170, 170, 170, 138, 66, 153,
+		106, 42, 0, 0, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 160, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 85, 80, 170, 169, 2, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		86, 85, 149, 170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 85, 105, 149,
+		170, 106, 0, 0, 86, 149, 86, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 90, 85, 85, 149, 165, 170, 42, 0, 0, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 0,
+	},
+	{
+		170, 170, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 21, 85, 101,
+		170, 10, 0, 0, 170, 170, 170, 170, 170, 170, 170, 2, 170, 170, 170, 170,
+		170, 170, 170, 170, 80, 85, 85, 85, 85, 85, 88, 85, 89, 22, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 42, 138, 170, 170, 170, 170, 170, 170, 170, 170, 170, 86, 21, 16, 69,
+		85, 101, 0, 0, 170, 170, 10, 0, 170, 138, 162, 170, 170, 170, 170, 170,
+		170, 170, 170, 42, 133, 102, 2, 0, 170, 170, 10, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 106, 169, 2, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 0, 0, 128,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 170, 2, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 85, 85, 1, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 0,
+		170, 170, 170, 170, 170, 170, 170, 42, 170, 170, 10, 160, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42,
+		170, 170, 10, 0, 170, 170, 170, 170, 170, 170, 170, 10, 85, 9, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 149, 170, 170,
+		170, 10, 0, 0, 170, 170, 138, 170, 138, 170, 170, 170, 170, 170, 0, 168,
+		170, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 42, 64, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 0, 64, 149, 170, 170, 170, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 255, 1, 0, 0, 15, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 252, 255, 60,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 63, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 63, 0, 0, 0, 0, 255, 0, 0, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 170, 170, 170, 2,
+		170, 170, 2, 0, 170, 170, 10, 150, 85, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 5, 85, 85, 85, 85,
+		85, 21, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 168, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 106, 165, 170, 106, 85, 85, 85,
+		149, 86, 85, 170, 170, 170, 170, 170, 170, 170, 90, 165, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		90, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 42, 0, 0, 170, 170, 170, 170, 170, 170, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 162, 32, 40, 168, 162, 170, 170, 138, 168,
+		170, 168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 138, 42, 168, 170, 162, 170, 162, 170, 170, 170, 170, 170, 170, 138, 42,
+		170, 34, 160, 170, 162, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 10, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 160, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 149, 106, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 169, 170, 166, 170, 170,
+		170, 169, 170, 0, 0, 0, 64, 85, 84, 85, 85, 85, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		85, 21, 85, 85, 85, 85, 65, 85, 69, 81, 21, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 85, 149, 170, 10,
+		170, 170, 10, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 26, 0, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 85, 170, 170, 10, 128,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 170, 42, 170, 40, 170, 170, 170, 42,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 130, 170, 170, 85, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 85, 149, 0, 170, 170, 10, 160, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 168, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		168, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 168, 170, 170, 170, 170, 170, 170, 40, 130, 168, 170, 42, 170, 136, 0,
+		32, 128, 136, 168, 40, 130, 136, 136, 40, 130, 42, 170, 42, 170, 168, 34,
+		170, 170, 138, 170, 170, 170, 170, 0, 168, 168, 138, 170, 170, 170, 170, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+	},
+	{
+		170, 171, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 0, 0, 0, 170, 170, 170, 42, 168, 170, 170, 170,
+		168, 170, 170, 234, 168, 170, 170, 170, 170, 170, 170, 170, 170, 10, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 186, 254, 255, 191, 170, 170, 170, 170, 10, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 160, 170, 170, 170, 170, 170, 170,
+	},
+	{
+		63, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
+		255, 255, 3, 0, 15, 0, 0, 0, 255, 15, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 171, 170, 170, 254, 255, 239, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251,
+		255, 255, 255, 255, 255, 170, 170, 170, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 191, 234, 255, 170, 170, 170, 255, 255, 255, 255, 171, 171, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191,
+		251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 175,
+		170, 170, 234, 191, 255, 255, 255, 255, 255, 255, 170, 170, 170, 170, 186, 170,
+		170, 170, 170, 170, 170, 190, 170, 170, 170, 171, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 234, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 175, 170, 171, 191, 254, 0, 252, 170, 170, 234, 3, 170, 255, 255, 3,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 0, 0, 0,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 2, 0, 255, 255, 255, 0, 3, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 0, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 0, 0, 170, 170, 10, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 0, 0, 170, 170, 170, 170, 170, 170, 170, 10, 10, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 255,
+		255, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 0, 0, 0, 170, 170, 170, 10, 255, 3, 255, 3,
+		255, 63, 0, 0, 255, 255, 255, 255, 255, 255, 255, 3, 255, 255, 63, 0,
+		255, 15, 0, 0, 255, 255, 15, 0, 255, 255, 0, 0, 255, 63, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 42, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 170, 170, 10, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 0,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 15, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 15, 0, 0, 0, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 3, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		4, 0, 0, 0, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+		85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 0, 0, 0, 0,
+	},
+	{
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 10,
+	},
+};
+
+static inline int charWidth(wchar_t ch) {
+	if ((unsigned long)ch > 0x10FFFF) return -1;
+	unsigned cell = WidthCells[WidthBlocks[ch >> 8]][(ch & 0xFF) >> 2];
+	return (cell >> (ch & 3) * 2 & 3) - 1;
+}
@@ -35,12 +35,42 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
 
 #include "chat.h"
 
 #define MAIN_LINES (LINES - StatusLines - InputLines)
 
+// A window's piece of the status line, rebuilt only when the window is
+// marked as changed and what it shows has. Its own formatting takes at most
+// three runs, so only formatting in names can run out of them, and the rest
+// of the name keeps the last style.
+struct Segment {
+	bool dirty;
+	uint pos;
+	bool drawn;
+	uint others;
+	enum Heat othersHeat;
+	uint num;
+	bool show;
+	bool pending;
+	bool mute;
+	enum Heat thresh;
+	enum Heat heat;
+	uint unread;
+	int scroll;
+	size_t hot, hots;
+	enum Color color;
+	char *name;
+	char str[256];
+	struct Run runs[8];
+	size_t nruns;
+};
+
+enum { StateLen = 6 };
+
 static struct Window {
 	uint id;
 	int scroll;
@@ -52,17 +82,58 @@ static struct Window {
 	uint unreadSoft;
 	uint unreadHard;
 	uint unreadWarm;
+	int cols;
 	struct Buffer *buffer;
+	struct Segment segment;
+	// What has happened since the window was last drawn to uiMain, if it is
+	// shown, or to its pad.
+	struct {
+		bool all;
+		int scroll;
+		int pushed;
+	} damage;
+	WINDOW *pad;
+	uint padUse;
+	// Lines in the save file not yet pushed to the buffer, or whether those
+	// at the end of the window's logs are yet to be, if none were saved.
+	struct {
+		const byte *data;
+		size_t size;
+		uint64_t sum;
+		bool backlog;
+	} lazy;
+	// What has been written to the journal.
+	struct {
+		bool fresh;
+		uint num;
+		uint64_t state[StateLen];
+	} journal;
 } *windows[IDCap];
 
 static uint count;
 static uint show;
 static uint swap;
 static uint user;
+static bool reordered;
+
+// Windows marked since the status line was last drawn. With statusAll,
+// every window is checked instead, after windows are inserted or removed.
+static struct Window *dirty[IDCap];
+static uint ndirty;
+static bool statusAll;
+
+static void statusMark(struct Window *window) {
+	uiDirty |= DrawStatus;
+	if (window->segment.dirty) return;
+	window->segment.dirty = true;
+	dirty[ndirty++] = window;
+}
 
 static uint windowPush(struct Window *window) {
 	assert(count < IDCap);
 	windows[count] = window;
+	window->segment.pos = count;
+	statusMark(window);
 	return count++;
 }
 
@@ -76,6 +147,8 @@ static uint windowInsert(uint num, struct Window *window) {
 	);
 	windows[num] = window;
 	count++;
+	statusAll = true;
+	uiDirty |= DrawStatus;
 	return num;
 }
 
@@ -88,18 +161,54 @@ static struct Window *windowRemove(uint num) {
 		&windows[num + 1],
 		sizeof(*windows) * (count - num)
 	);
+	statusAll = true;
+	uiDirty |= DrawStatus;
 	return window;
 }
 
+static struct Window *shown;
+
+// The save file stays mapped until every window has been loaded from it.
+static struct {
+	void *ptr;
+	size_t len;
+	uint lazy;
+} map;
+
+static bool mapped(const byte *data) {
+	return data >= (byte *)map.ptr && data < (byte *)map.ptr + map.len;
+}
+
+static void lazyDrop(struct Window *window) {
+	const byte *data = window->lazy.data;
+	if (!data) return;
+	window->lazy.data = NULL;
+	if (!mapped(data)) {
+		free((byte *)data);
+	} else if (!--map.lazy) {
+		munmap(map.ptr, map.len);
+		map.ptr = NULL;
+		map.len = 0;
+	}
+}
+
 static void windowFree(struct Window *window) {
+	lazyDrop(window);
+	if (window == shown) shown = NULL;
+	if (window->pad) delwin(window->pad);
 	completeRemove(None, idNames[window->id]);
 	bufferFree(window->buffer);
+	free(window->segment.name);
 	free(window);
 }
 
 enum Heat windowThreshold = Cold;
 struct Time windowTime = { .format = "%X" };
 
+static int windowCols(const struct Window *window) {
+	return COLS - (window->time ? windowTime.width : 0);
+}
+
 uint windowFor(uint id) {
 	for (uint num = 0; num < count; ++num) {
 		if (windows[num]->id == id) return num;
@@ -116,9 +225,13 @@ uint windowFor(uint id) {
 	} else {
 		window->thresh = windowThreshold;
 	}
+	window->cols = windowCols(window);
 	window->buffer = bufferAlloc();
+	window->lazy.backlog = logBacklog;
 	completePush(None, idNames[id], idColors[id]);
 
+	window->journal.fresh = true;
+	reordered = true;
 	return windowPush(window);
 }
 
@@ -155,124 +268,467 @@ static int styleAdd(WINDOW *win, struct Style init, const char *str) {
 	return 0;
 }
 
+static int runsAdd(
+	WINDOW *win, const char *str, const struct Run *runs, size_t nruns
+) {
+	size_t len = strlen(str);
+	for (size_t i = 0; i < nruns; ++i) {
+		const struct Run *run = &runs[i];
+		size_t end = (i + 1 < nruns ? run[1].pos : len);
+		wattr_set(win, uiAttr(run->style), uiPair(run->style), NULL);
+		if (waddnstr(win, &str[run->pos], end - run->pos) == ERR)
+			return -1;
+	}
+	return 0;
+}
+
+static size_t windowTop(const struct Window *window) {
+	size_t top = BufferCap - MAIN_LINES - window->scroll;
+	if (window->scroll) top += MarkerLines;
+	return top;
+}
+
+static size_t windowBottom(const struct Window *window) {
+	size_t bottom = BufferCap - (window->scroll ?: 1);
+	if (window->scroll) bottom -= SplitLines + MarkerLines;
+	return bottom;
+}
+
 static void statusUpdate(void) {
-	struct {
-		uint unread;
-		enum Heat heat;
-	} others = { 0, Cold };
+	uiDirty |= DrawStatus;
+}
 
-	wmove(uiStatus, 0, 0);
-	for (uint num = 0; num < count; ++num) {
-		const struct Window *window = windows[num];
-		if (num != show && !window->scroll && !inputPending(window->id)) {
-			if (window->heat < Warm) continue;
-			if (window->mute && window->heat < Hot) continue;
-		}
-		if (num != show) {
-			others.unread += window->unreadWarm;
-			if (window->heat > others.heat) others.heat = window->heat;
-		}
-		char buf[256], *end = &buf[sizeof(buf)];
-		char *ptr = seprintf(
-			buf, end, "\3%d%s %u%s%s %s ",
-			idColors[window->id], (num == show ? "\26" : ""),
-			num, window->thresh[(const char *[]) { "-", "", "+", "++" }],
-			&"="[!window->mute], idNames[window->id]
+static bool segmentUpdate(struct Window *window, uint num) {
+	struct Segment *seg = &window->segment;
+	struct Segment key = {
+		.num = num,
+		.show = (num == show),
+		.pending = (num != show && inputPending(window->id)),
+		.mute = window->mute,
+		.thresh = window->thresh,
+		.heat = window->heat,
+		.unread = (window->mark ? window->unreadWarm : 0),
+		.scroll = window->scroll,
+		.color = idColors[window->id],
+	};
+	const struct Line *line = bufferHard(window->buffer, windowTop(window));
+	if (key.scroll && line) {
+		key.hot = bufferHotRank(window->buffer, line->num, &key.hots);
+	}
+	if (
+		seg->name && !strcmp(seg->name, idNames[window->id]) &&
+		seg->num == key.num && seg->show == key.show &&
+		seg->pending == key.pending && seg->mute == key.mute &&
+		seg->thresh == key.thresh && seg->heat == key.heat &&
+		seg->unread == key.unread && seg->scroll == key.scroll &&
+		seg->hot == key.hot && seg->hots == key.hots &&
+		seg->color == key.color
+	) return false;
+
+	char buf[sizeof(seg->str)], *end = &buf[sizeof(buf)];
+	char *ptr = seprintf(
+		buf, end, "\3%d%s %u%s%s %s ",
+		key.color, (key.show ? "\26" : ""),
+		num, window->thresh[(const char *[]) { "-", "", "+", "++" }],
+		&"="[!key.mute], idNames[window->id]
+	);
+	if (key.unread) {
+		ptr = seprintf(
+			ptr, end, "\3%d+%d\3%d ",
+			(key.heat > Warm ? White : key.color), key.unread, key.color
 		);
-		if (window->mark && window->unreadWarm) {
-			ptr = seprintf(
-				ptr, end, "\3%d+%d\3%d ",
-				(window->heat > Warm ? White : idColors[window->id]),
-				window->unreadWarm, idColors[window->id]
-			);
+	}
+	if (key.scroll) {
+		ptr = seprintf(ptr, end, "~%d ", key.scroll);
+	}
+	if (key.hots) {
+		ptr = seprintf(ptr, end, "!%zu/%zu ", key.hot, key.hots);
+	}
+	if (key.pending) {
+		ptr = seprintf(ptr, end, "@ ");
+	}
+
+	free(seg->name);
+	key.name = strdup(idNames[window->id]);
+	if (!key.name) err(1, "strdup");
+	key.dirty = seg->dirty;
+	key.drawn = seg->drawn;
+	key.others = seg->others;
+	key.othersHeat = seg->othersHeat;
+	*seg = key;
+
+	size_t len = 0;
+	struct Style style = StyleDefault;
+	for (const char *str = buf; *str;) {
+		size_t n = styleParse(&style, &str);
+		if (!n) continue;
+		if (seg->nruns < ARRAY_LEN(seg->runs)) {
+			seg->runs[seg->nruns++] = (struct Run) { len, style };
 		}
-		if (window->scroll) {
-			ptr = seprintf(ptr, end, "~%d ", window->scroll);
+		memcpy(&seg->str[len], str, n);
+		len += n;
+		str += n;
+	}
+	seg->str[len] = '\0';
+	return true;
+}
+
+// Windows whose segments are drawn, in order, and what the windows not
+// shown add up to for the title.
+static struct Window *drawn[IDCap];
+static uint ndrawn;
+static struct {
+	uint unread;
+	uint heats[Hot + 1];
+} others;
+
+static bool statusShown(const struct Window *window, uint num) {
+	if (num == show || window->scroll || inputPending(window->id)) {
+		return true;
+	}
+	if (window->heat < Warm) return false;
+	if (window->mute && window->heat < Hot) return false;
+	return true;
+}
+
+static uint drawnFind(uint num) {
+	uint lo = 0, hi = ndrawn;
+	while (lo < hi) {
+		uint mid = lo + (hi - lo) / 2;
+		if (drawn[mid]->segment.num < num) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
-		if (num != show && inputPending(window->id)) {
-			ptr = seprintf(ptr, end, "@ ");
+	}
+	return lo;
+}
+
+// Rebuild a window's segment and its place on the status line, returning
+// whether the status line needs drawing.
+static bool statusCheck(struct Window *window, uint num) {
+	struct Segment *seg = &window->segment;
+	seg->dirty = false;
+	if (seg->drawn) {
+		others.unread -= seg->others;
+		others.heats[seg->othersHeat]--;
+	}
+	bool was = seg->drawn;
+	bool changed = false;
+	seg->drawn = statusShown(window, num);
+	if (seg->drawn) {
+		changed = segmentUpdate(window, num);
+		seg->others = (num == show ? 0 : window->unreadWarm);
+		seg->othersHeat = (num == show ? Ice : window->heat);
+		others.unread += seg->others;
+		others.heats[seg->othersHeat]++;
+	}
+	if (seg->drawn == was) return changed && seg->drawn;
+	uint i = drawnFind(num);
+	if (seg->drawn) {
+		memmove(&drawn[i + 1], &drawn[i], sizeof(*drawn) * (ndrawn - i));
+		drawn[i] = window;
+		ndrawn++;
+	} else {
+		ndrawn--;
+		memmove(&drawn[i], &drawn[i + 1], sizeof(*drawn) * (ndrawn - i));
+	}
+	return true;
+}
+
+static void statusDraw(void) {
+	bool changed = false;
+	if (statusAll) {
+		ndirty = 0;
+		ndrawn = 0;
+		others.unread = 0;
+		memset(others.heats, 0, sizeof(others.heats));
+		for (uint num = 0; num < count; ++num) {
+			struct Window *window = windows[num];
+			window->segment.pos = num;
+			window->segment.drawn = false;
+			statusCheck(window, num);
 		}
-		if (styleAdd(uiStatus, StyleDefault, buf) < 0) break;
+		statusAll = false;
+		changed = true;
+	}
+	for (uint i = 0; i < ndirty; ++i) {
+		struct Window *window = dirty[i];
+		if (statusCheck(window, window->segment.pos)) changed = true;
 	}
-	wclrtoeol(uiStatus);
+	ndirty = 0;
 
+	if (changed) {
+		wmove(uiStatus, 0, 0);
+		for (uint i = 0; i < ndrawn; ++i) {
+			const struct Segment *seg = &drawn[i]->segment;
+			if (runsAdd(uiStatus, seg->str, seg->runs, seg->nruns) < 0) break;
+		}
+		wclrtoeol(uiStatus);
+	}
+
+	enum Heat othersHeat = Cold;
+	for (enum Heat heat = Cold; heat <= Hot; ++heat) {
+		if (others.heats[heat]) othersHeat = heat;
+	}
+	static struct {
+		const struct Window *window;
+		const char *network;
+		uint unread;
+		enum Heat heat;
+		uint others;
+		enum Heat othersHeat;
+	} title;
 	const struct Window *window = windows[show];
+	if (
+		!changed && title.window == window &&
+		title.network == network.name &&
+		title.unread == window->segment.unread &&
+		title.heat == window->heat &&
+		title.others == others.unread && title.othersHeat == othersHeat
+	) return;
+	title.window = window;
+	title.network = network.name;
+	title.unread = window->segment.unread;
+	title.heat = window->heat;
+	title.others = others.unread;
+	title.othersHeat = othersHeat;
+
 	char *end = &uiTitle[sizeof(uiTitle)];
 	char *ptr = seprintf(
 		uiTitle, end, "%s %s", network.name, idNames[window->id]
 	);
-	if (window->mark && window->unreadWarm) {
+	if (title.unread) {
 		ptr = seprintf(
-			ptr, end, " +%d%s", window->unreadWarm, &"!"[window->heat < Hot]
+			ptr, end, " +%d%s", title.unread, &"!"[window->heat < Hot]
 		);
 	}
 	if (others.unread) {
 		ptr = seprintf(
-			ptr, end, " (+%d%s)", others.unread, &"!"[others.heat < Hot]
+			ptr, end, " (+%d%s)", others.unread, &"!"[othersHeat < Hot]
 		);
 	}
 }
 
-static size_t windowTop(const struct Window *window) {
-	size_t top = BufferCap - MAIN_LINES - window->scroll;
-	if (window->scroll) top += MarkerLines;
-	return top;
-}
+static struct Stamp stamp;
 
-static size_t windowBottom(const struct Window *window) {
-	size_t bottom = BufferCap - (window->scroll ?: 1);
-	if (window->scroll) bottom -= SplitLines + MarkerLines;
-	return bottom;
+static struct {
+	uint id;
+	char *str;
+	int dir;
+} search = { .dir = -1 };
+
+// Draw runs as runsAdd does, reversing each occurrence of mark.
+static void markAdd(WINDOW *win, const struct Line *line, const char *mark) {
+	size_t len = strlen(line->str);
+	size_t n = strlen(mark);
+	const char *match = strcasestr(line->str, mark);
+	for (size_t i = 0; i < line->nruns; ++i) {
+		const struct Run *run = &line->runs[i];
+		size_t end = (i + 1 < line->nruns ? run[1].pos : len);
+		for (size_t pos = run->pos; pos < end;) {
+			size_t from = (match ? (size_t)(match - line->str) : len);
+			size_t to = (match ? from + n : len);
+			if (pos >= to) {
+				match = strcasestr(&line->str[to], mark);
+				continue;
+			}
+			struct Style style = run->style;
+			size_t stop = (pos < from ? from : to);
+			if (stop > end) stop = end;
+			if (pos >= from) style.attr ^= Reverse;
+			wattr_set(win, uiAttr(style), uiPair(style), NULL);
+			if (waddnstr(win, &line->str[pos], stop - pos) == ERR) return;
+			pos = stop;
+		}
+	}
 }
 
-static void mainAdd(int y, bool time, const struct Line *line) {
+static void mainAdd(
+	WINDOW *win, int y, bool time, const struct Line *line, const char *mark
+) {
 	int ny, nx;
-	wmove(uiMain, y, 0);
+	wmove(win, y, 0);
 	if (!line || !line->str[0]) {
-		wclrtoeol(uiMain);
+		wclrtoeol(win);
 		return;
 	}
 	if (time && line->time) {
-		char buf[TimeCap];
-		strftime(buf, sizeof(buf), windowTime.format, localtime(&line->time));
 		struct Style init = { .fg = Gray, .bg = Default };
-		styleAdd(uiMain, init, buf);
-		waddch(uiMain, ' ');
+		styleAdd(
+			win, init, stampFormat(&stamp, windowTime.format, line->time)
+		);
+		waddch(win, ' ');
 	} else if (time) {
-		whline(uiMain, ' ', windowTime.width);
-		wmove(uiMain, y, windowTime.width);
+		wattr_set(win, A_NORMAL, 0, NULL);
+		whline(win, ' ', windowTime.width);
+		wmove(win, y, windowTime.width);
+	}
+	if (mark) {
+		markAdd(win, line, mark);
+	} else {
+		runsAdd(win, line->str, line->runs, line->nruns);
 	}
-	styleAdd(uiMain, StyleDefault, line->str);
-	getyx(uiMain, ny, nx);
+	getyx(win, ny, nx);
 	if (ny != y) return;
-	wclrtoeol(uiMain);
+	wclrtoeol(win);
 	(void)nx;
 }
 
+static void mainRow(WINDOW *win, const struct Window *window, int y) {
+	int marker = MAIN_LINES - SplitLines - MarkerLines;
+	if (window->scroll && y >= marker && y < MAIN_LINES - SplitLines) {
+		wattr_set(win, A_NORMAL, 0, NULL);
+		mvwhline(win, y, 0, ACS_BULLET, COLS);
+		return;
+	}
+	size_t top = BufferCap - MAIN_LINES;
+	if (window->scroll && y < marker) top = windowTop(window);
+	mainAdd(
+		win, y, window->time, bufferHard(window->buffer, top + y),
+		(search.str && search.id == window->id ? search.str : NULL)
+	);
+}
+
 static void mainUpdate(void) {
-	const struct Window *window = windows[show];
+	windows[show]->damage.all = true;
+	uiDirty |= DrawMain;
+}
 
-	int y = 0;
-	int marker = MAIN_LINES - SplitLines - MarkerLines;
-	for (size_t i = windowTop(window); i < BufferCap; ++i) {
-		mainAdd(y++, window->time, bufferHard(window->buffer, i));
-		if (window->scroll && y == marker) break;
+// The content of rows top to bottom has moved up by n, so scroll what is
+// already drawn and only draw the rows which are exposed.
+static void mainShift(
+	WINDOW *win, const struct Window *window, int top, int bottom, int n
+) {
+	if (!n || bottom <= top) return;
+	if (abs(n) >= bottom - top) {
+		for (int y = top; y < bottom; ++y) mainRow(win, window, y);
+		return;
+	}
+	scrollok(win, true);
+	wsetscrreg(win, top, bottom - 1);
+	wscrl(win, n);
+	wsetscrreg(win, 0, MAIN_LINES - 1);
+	scrollok(win, false);
+	if (n > 0) {
+		for (int y = bottom - n; y < bottom; ++y) mainRow(win, window, y);
+	} else {
+		for (int y = top; y < top - n; ++y) mainRow(win, window, y);
 	}
-	if (!window->scroll) return;
+}
+
+static void mainDraw(WINDOW *win, struct Window *window) {
+	int scroll = window->damage.scroll;
+	int pushed = window->damage.pushed;
+	if (window->damage.all || !scroll != !window->scroll) {
+		for (int y = 0; y < MAIN_LINES; ++y) mainRow(win, window, y);
+	} else if (!window->scroll) {
+		mainShift(win, window, 0, MAIN_LINES, pushed);
+	} else {
+		int marker = MAIN_LINES - SplitLines - MarkerLines;
+		int n = pushed - (window->scroll - scroll);
+		mainShift(win, window, 0, marker, n);
+		mainShift(win, window, MAIN_LINES - SplitLines, MAIN_LINES, pushed);
+	}
+	window->damage.all = false;
+	window->damage.scroll = window->scroll;
+	window->damage.pushed = 0;
+}
+
+// A few windows which are likely to be shown next are kept drawn in pads,
+// so switching to them is a copy.
+enum { PadCap = 4 };
+static uint padClock;
 
-	y = MAIN_LINES - SplitLines;
-	for (size_t i = BufferCap - SplitLines; i < BufferCap; ++i) {
-		mainAdd(y++, window->time, bufferHard(window->buffer, i));
+static void padKeep(struct Window *window) {
+	window->padUse = ++padClock;
+	if (window->pad) return;
+	uint pads = 0;
+	struct Window *lru = NULL;
+	for (uint num = 0; num < count; ++num) {
+		struct Window *other = windows[num];
+		if (!other->pad) continue;
+		pads++;
+		if (!lru || other->padUse < lru->padUse) lru = other;
+	}
+	if (pads >= PadCap) {
+		delwin(lru->pad);
+		lru->pad = NULL;
+	}
+	window->pad = newpad(MAIN_LINES, COLS);
+	if (!window->pad) err(1, "newpad");
+	window->damage.all = true;
+	uiDirty |= DrawPads;
+}
+
+static void padFree(void) {
+	for (uint num = 0; num < count; ++num) {
+		if (!windows[num]->pad) continue;
+		delwin(windows[num]->pad);
+		windows[num]->pad = NULL;
 	}
-	wattr_set(uiMain, A_NORMAL, 0, NULL);
-	mvwhline(uiMain, marker, 0, ACS_BULLET, COLS);
+}
+
+struct WindowStats windowStats;
+static uint64_t switchStart;
+
+static uint64_t nsec(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void mainCopy(WINDOW *src, WINDOW *dst) {
+	copywin(src, dst, 0, 0, 0, 0, MAIN_LINES - 1, COLS - 1, false);
+}
+
+static void mainSwitch(struct Window *window) {
+	switchStart = nsec();
+	windowStats.switches++;
+	window->padUse = ++padClock;
+	if (shown) {
+		mainDraw(uiMain, shown);
+		padKeep(shown);
+		mainCopy(uiMain, shown->pad);
+		shown->damage.all = false;
+	}
+	shown = window;
+	if (window->pad) {
+		windowStats.hits++;
+		mainDraw(window->pad, window);
+		mainCopy(window->pad, uiMain);
+	} else {
+		window->damage.all = true;
+	}
+	uiDirty |= DrawMain;
 }
 
 void windowUpdate(void) {
+	statusAll = true;
 	statusUpdate();
 	mainUpdate();
 }
 
+void windowDraw(void) {
+	if (uiDirty & DrawStatus) statusDraw();
+	if (uiDirty & DrawMain) {
+		mainDraw(uiMain, windows[show]);
+		if (switchStart) {
+			uint64_t time = nsec() - switchStart;
+			windowStats.time += time;
+			if (time > windowStats.max) windowStats.max = time;
+			switchStart = 0;
+		}
+	}
+	if (uiDirty & DrawPads) {
+		for (uint num = 0; num < count; ++num) {
+			struct Window *window = windows[num];
+			if (window == shown || !window->pad) continue;
+			mainDraw(window->pad, window);
+		}
+	}
+}
+
 void windowBare(void) {
 	uiHide();
 	inputWait();
@@ -291,11 +747,9 @@ void windowBare(void) {
 			continue;
 		}
 
-		char buf[TimeCap];
 		struct Style style = { .fg = Gray, .bg = Default };
-		strftime(buf, sizeof(buf), windowTime.format, localtime(&line->time));
 		vid_attr(uiAttr(style), uiPair(style), NULL);
-		printf("%s ", buf);
+		printf("%s ", stampFormat(&stamp, windowTime.format, line->time));
 
 		bool align = false;
 		style = StyleDefault;
@@ -330,10 +784,10 @@ static void unmark(struct Window *window) {
 		window->mark = false;
 		window->heat = Cold;
 	}
-	statusUpdate();
+	statusMark(window);
 }
 
-static void scrollN(struct Window *window, int n) {
+static void scrollBy(struct Window *window, int n) {
 	mark(window);
 	window->scroll += n;
 	if (window->scroll > BufferCap - MAIN_LINES) {
@@ -341,7 +795,15 @@ static void scrollN(struct Window *window, int n) {
 	}
 	if (window->scroll < 0) window->scroll = 0;
 	unmark(window);
-	if (window == windows[show]) mainUpdate();
+}
+
+static void scrollN(struct Window *window, int n) {
+	scrollBy(window, n);
+	if (window == windows[show]) {
+		uiDirty |= DrawMain;
+	} else if (window->pad) {
+		uiDirty |= DrawPads;
+	}
 }
 
 static void scrollTo(struct Window *window, int top) {
@@ -349,13 +811,171 @@ static void scrollTo(struct Window *window, int top) {
 	scrollN(window, top - MAIN_LINES + MarkerLines);
 }
 
-static int windowCols(const struct Window *window) {
-	return COLS - (window->time ? windowTime.width : 0);
+static void cool(struct Window *window) {
+	const struct Line *line = bufferHard(window->buffer, windowTop(window));
+	if (!line) return;
+	bufferCool(
+		window->buffer, line->num, (window->mark ? window->unreadSoft : 0)
+	);
+}
+
+enum { RecordHead = sizeof(int64_t) + 1 + sizeof(uint32_t) };
+
+// Push saved line records, returning where they stop making sense.
+static const byte *
+recordsPush(struct Window *window, const byte *ptr, const byte *end) {
+	char *buf = NULL;
+	size_t cap = 0;
+	while (ptr < end) {
+		int64_t time;
+		uint32_t len;
+		if ((size_t)(end - ptr) < RecordHead) break;
+		memcpy(&time, ptr, sizeof(time));
+		enum Heat heat = ptr[sizeof(time)];
+		memcpy(&len, &ptr[sizeof(time) + 1], sizeof(len));
+		ptr += RecordHead;
+		if ((size_t)(end - ptr) < len || heat > Hot) break;
+		if (len + 1 > cap) {
+			cap = len + 1;
+			free(buf);
+			buf = malloc(cap);
+			if (!buf) err(1, "malloc");
+		}
+		memcpy(buf, ptr, len);
+		buf[len] = '\0';
+		ptr += len;
+		bufferPush(
+			window->buffer, window->cols, window->thresh, heat, time, buf
+		);
+	}
+	free(buf);
+	return ptr;
+}
+
+static uint newest(const struct Window *window) {
+	const struct Line *line = bufferSoft(window->buffer, BufferCap - 1);
+	return (line ? line->num : 0);
+}
+
+// Logs are named for the network once it is known, so the Network window's
+// backlog waits until then.
+static bool named;
+
+void windowBacklog(void) {
+	named = true;
+}
+
+static bool backlogDue(const struct Window *window) {
+	return window->lazy.backlog && (named || window->id != Network);
+}
+
+// Lines from the logs at or after until were logged by logFormat() before
+// being written to the window, so only those before it are loaded, ahead
+// of any lines the window already holds.
+static void backlog(struct Window *window, const time_t *until) {
+	static struct LogLine loaded[BufferCap];
+	window->lazy.backlog = false;
+	size_t n = logLoad(window->id, loaded, BufferCap);
+	while (n && until && loaded[n - 1].time >= *until) n--;
+	if (!n) return;
+	struct Buffer *buffer = NULL;
+	if (newest(window)) {
+		buffer = window->buffer;
+		window->buffer = bufferAlloc();
+	}
+	for (size_t i = 0; i < n; ++i) {
+		bufferPush(
+			window->buffer, window->cols, window->thresh,
+			loaded[i].heat, loaded[i].time, loaded[i].str
+		);
+	}
+	if (!buffer) return;
+	for (size_t i = 0; i < BufferCap; ++i) {
+		const struct Line *line = bufferSoft(buffer, i);
+		if (!line) continue;
+		bufferPush(
+			window->buffer, window->cols, window->thresh,
+			line->heat, line->time, line->str
+		);
+	}
+	bufferFree(buffer);
+	window->unreadHard = bufferReflow(
+		window->buffer, window->cols, window->thresh, window->unreadSoft
+	);
+	window->damage.all = true;
+	window->journal.fresh = true;
+	window->journal.num = 0;
+	uiDirty |= DrawMain | DrawPads;
+}
+
+static void materialize(struct Window *window) {
+	if (backlogDue(window)) {
+		const struct Line *line = NULL;
+		for (size_t i = 0; !line && i < BufferCap; ++i) {
+			line = bufferSoft(window->buffer, i);
+		}
+		time_t until = (line ? line->time : 0);
+		backlog(window, (line ? &until : NULL));
+	}
+	if (!window->lazy.data) return;
+	const byte *ptr = window->lazy.data;
+	const byte *end = &ptr[window->lazy.size];
+	bool corrupt = (sum(SumInit, ptr, window->lazy.size) != window->lazy.sum);
+	if (!corrupt) ptr = recordsPush(window, ptr, end);
+	if (ptr < end) corrupt = true;
+	lazyDrop(window);
+	// Lines loaded from the save file or journal are already in them.
+	window->journal.num = newest(window);
+	window->cols = windowCols(window);
+	window->unreadHard = bufferReflow(
+		window->buffer, window->cols, window->thresh, window->unreadSoft
+	);
+	if (corrupt) {
+		uiFormat(window->id, Warm, NULL, "Saved scrollback is corrupt");
+	}
+}
+
+static void reflow(struct Window *window) {
+	materialize(window);
+	uint num = 0;
+	const struct Line *line = bufferHard(window->buffer, windowTop(window));
+	if (line) num = line->num;
+	window->cols = windowCols(window);
+	window->unreadHard = bufferReflow(
+		window->buffer, window->cols, window->thresh, window->unreadSoft
+	);
+	if (!window->scroll || !num) return;
+	size_t i = bufferFind(window->buffer, num);
+	if (i < BufferCap) scrollTo(window, BufferCap - i);
+}
+
+// Return the window windowAuto() would show, or count if none.
+static uint autoNum(void) {
+	uint minHot = UINT_MAX, numHot = count;
+	uint minWarm = UINT_MAX, numWarm = count;
+	for (uint num = 0; num < count; ++num) {
+		struct Window *window = windows[num];
+		if (window->heat >= Hot) {
+			if (window->unreadWarm >= minHot) continue;
+			minHot = window->unreadWarm;
+			numHot = num;
+		}
+		if (window->heat >= Warm && !window->mute) {
+			if (window->unreadWarm >= minWarm) continue;
+			minWarm = window->unreadWarm;
+			numWarm = num;
+		}
+	}
+	return (numHot < count ? numHot : numWarm);
 }
 
 bool windowWrite(uint id, enum Heat heat, const time_t *src, const char *str) {
-	struct Window *window = windows[windowFor(id)];
+	uint num = windowFor(id);
+	struct Window *window = windows[num];
 	time_t ts = (src ? *src : time(NULL));
+	if (backlogDue(window) && !newest(window)) backlog(window, &ts);
+	materialize(window);
+	int pushed = 0;
 
 	if (heat >= window->thresh) {
 		if (!window->unreadSoft++) window->unreadHard = 0;
@@ -363,50 +983,53 @@ bool windowWrite(uint id, enum Heat heat, const time_t *src, const char *str) {
 	if (window->mark && heat > Cold) {
 		if (!window->unreadWarm++) {
 			int lines = bufferPush(
-				window->buffer, windowCols(window),
-				window->thresh, Warm, ts, ""
+				window->buffer, window->cols, window->thresh, Warm, ts, ""
 			);
-			if (window->scroll) scrollN(window, lines);
+			pushed += lines;
+			if (window->scroll) scrollBy(window, lines);
 			if (window->unreadSoft > 1) {
 				window->unreadSoft++;
 				window->unreadHard += lines;
 			}
 		}
 		if (heat > window->heat) window->heat = heat;
-		statusUpdate();
 	}
+	statusMark(window);
 	int lines = bufferPush(
-		window->buffer, windowCols(window),
-		window->thresh, heat, ts, str
+		window->buffer, window->cols, window->thresh, heat, ts, str
 	);
 	window->unreadHard += lines;
-	if (window->scroll) scrollN(window, lines);
-	if (window == windows[show]) mainUpdate();
+	pushed += lines;
+	if (window->scroll) scrollBy(window, lines);
+	if (window->damage.pushed + pushed > BufferCap) {
+		window->damage.all = true;
+		window->damage.pushed = 0;
+	} else {
+		window->damage.pushed += pushed;
+	}
+	if (window == windows[show]) {
+		if (pushed) uiDirty |= DrawMain;
+	} else if (
+		(window->heat >= Hot || (window->heat >= Warm && !window->mute)) &&
+		(num == swap || num == autoNum())
+	) {
+		// Keep the windows M-/ and M-a would show ready to be shown.
+		if (window->cols != windowCols(window)) reflow(window);
+		padKeep(window);
+		if (pushed) uiDirty |= DrawPads;
+	} else if (window->pad && pushed) {
+		uiDirty |= DrawPads;
+	}
+	cool(window);
 
 	return window->mark && heat > Warm;
 }
 
-static void reflow(struct Window *window) {
-	uint num = 0;
-	const struct Line *line = bufferHard(window->buffer, windowTop(window));
-	if (line) num = line->num;
-	window->unreadHard = bufferReflow(
-		window->buffer, windowCols(window),
-		window->thresh, window->unreadSoft
-	);
-	if (!window->scroll || !num) return;
-	for (size_t i = 0; i < BufferCap; ++i) {
-		line = bufferHard(window->buffer, i);
-		if (!line || line->num != num) continue;
-		scrollTo(window, BufferCap - i);
-		break;
-	}
-}
-
+// Only the shown window is reflowed immediately. The rest are reflowed
+// when shown or kept in a pad, or from windowIdle() in the meantime.
 void windowResize(void) {
-	for (uint num = 0; num < count; ++num) {
-		reflow(windows[num]);
-	}
+	padFree();
+	reflow(windows[show]);
 	windowUpdate();
 }
 
@@ -423,36 +1046,23 @@ void windowShow(uint num) {
 	if (num != show) {
 		swap = show;
 		mark(windows[swap]);
+		statusMark(windows[swap]);
 	}
 	show = num;
 	user = num;
 	unmark(windows[show]);
-	mainUpdate();
+	struct Window *window = windows[show];
+	materialize(window);
+	if (window->cols != windowCols(window)) reflow(window);
+	if (window != shown) mainSwitch(window);
 	inputUpdate();
 }
 
 void windowAuto(void) {
-	uint minHot = UINT_MAX, numHot = 0;
-	uint minWarm = UINT_MAX, numWarm = 0;
-	for (uint num = 0; num < count; ++num) {
-		struct Window *window = windows[num];
-		if (window->heat >= Hot) {
-			if (window->unreadWarm >= minHot) continue;
-			minHot = window->unreadWarm;
-			numHot = num;
-		}
-		if (window->heat >= Warm && !window->mute) {
-			if (window->unreadWarm >= minWarm) continue;
-			minWarm = window->unreadWarm;
-			numWarm = num;
-		}
-	}
+	uint num = autoNum();
 	uint oldUser = user;
-	if (minHot < UINT_MAX) {
-		windowShow(numHot);
-		user = oldUser;
-	} else if (minWarm < UINT_MAX) {
-		windowShow(numWarm);
+	if (num < count) {
+		windowShow(num);
 		user = oldUser;
 	} else if (user != show) {
 		windowShow(user);
@@ -466,6 +1076,7 @@ void windowSwap(void) {
 void windowMove(uint from, uint to) {
 	if (from >= count) return;
 	struct Window *window = windowRemove(from);
+	reordered = true;
 	if (to < count) {
 		windowShow(windowInsert(to, window));
 	} else {
@@ -479,6 +1090,7 @@ void windowClose(uint num) {
 	struct Window *window = windowRemove(num);
 	completeRemove(window->id, NULL);
 	windowFree(window);
+	reordered = true;
 	if (swap >= num) swap--;
 	if (show == num) {
 		windowShow(swap);
@@ -510,7 +1122,7 @@ void windowUnmark(void) {
 
 void windowToggleMute(void) {
 	windows[show]->mute ^= true;
-	statusUpdate();
+	statusMark(windows[show]);
 }
 
 void windowToggleTime(void) {
@@ -560,62 +1172,414 @@ void windowScroll(enum Scroll by, int n) {
 			scrollTo(window, window->unreadHard);
 		}
 		break; case ScrollHot: {
-			for (size_t i = windowTop(window) + n; i < BufferCap; i += n) {
-				const struct Line *line = bufferHard(window->buffer, i);
-				const struct Line *prev = bufferHard(window->buffer, i - 1);
-				if (!line || line->heat < Hot) continue;
-				if (prev && prev->heat > Warm) continue;
-				scrollTo(window, BufferCap - i);
-				break;
-			}
+			size_t top = windowTop(window);
+			const struct Line *line = bufferHard(window->buffer, top);
+			if (!line) break;
+			uint num = line->num;
+			// Count a hot line scrolled part way through as the previous.
+			if (n < 0 && bufferFind(window->buffer, num) < top) num++;
+			num = bufferHot(window->buffer, num, n);
+			if (!num) break;
+			scrollTo(window, BufferCap - bufferFind(window->buffer, num));
 		}
 	}
 }
 
+// With dir 0, refine the search in progress, which may still match at the
+// current line.
 void windowSearch(const char *str, int dir) {
 	struct Window *window = windows[show];
-	for (size_t i = windowTop(window) + dir; i < BufferCap; i += dir) {
-		const struct Line *line = bufferHard(window->buffer, i);
-		if (!line || !strcasestr(line->str, str)) continue;
-		scrollTo(window, BufferCap - i);
-		break;
+	if (search.str) windowSearchEnd();
+	if (!str[0]) return;
+	search.id = window->id;
+	search.str = strdup(str);
+	if (!search.str) err(1, "strdup");
+	mainUpdate();
+
+	const struct Line *line = bufferHard(window->buffer, windowTop(window));
+	if (!line) return;
+	uint num = line->num;
+	if (dir) {
+		search.dir = dir;
+	} else {
+		num -= search.dir;
+	}
+	line = bufferSearch(window->buffer, str, num, search.dir);
+	if (!line) return;
+	size_t i = bufferFind(window->buffer, line->num);
+	if (i < BufferCap) scrollTo(window, BufferCap - i);
+}
+
+void windowSearchEnd(void) {
+	if (!search.str) return;
+	free(search.str);
+	search.str = NULL;
+	for (uint num = 0; num < count; ++num) {
+		struct Window *window = windows[num];
+		if (window->id != search.id) continue;
+		window->damage.all = true;
+		uiDirty |= (window == shown ? DrawMain : DrawPads);
+	}
+}
+
+enum { IdleSlice = 4 * 1000 * 1000 };
+
+// A search of every window runs a slice at a time from windowIdle(), so
+// input is still handled and it can be cancelled part way. The windows are
+// those open when it started, by ID, so opening or closing windows in the
+// meantime doesn't shift it. Hits are listed once it ends, ranked by the
+// heat of their window, then of their line, then by time, and are kept
+// for windowHit() to show.
+// Hits are listed in <grep> as each slice finds them, keeping their numbers
+// for /hit, then the best are listed again ranked at the end.
+enum { GrepCap = BufferCap / 2, GrepBest = 16 };
+struct Hit {
+	uint id;
+	uint num;
+	time_t time;
+	enum Heat heat;
+	enum Heat windowHeat;
+};
+static struct {
+	char *str;
+	uint id;
+	uint ids[IDCap];
+	uint nids;
+	uint next;
+	uint line;
+	struct Hit *hits;
+	size_t len;
+	size_t cap;
+	size_t listed;
+} grep;
+
+static struct Window *windowByID(uint id) {
+	for (uint num = 0; num < count; ++num) {
+		if (windows[num]->id == id) return windows[num];
 	}
+	return NULL;
 }
 
-static int writeTime(FILE *file, time_t time) {
-	return (fwrite(&time, sizeof(time), 1, file) ? 0 : -1);
+// Return the soft line num of window, if it is still in the buffer.
+static const struct Line *windowLine(const struct Window *window, uint num) {
+	uint last = newest(window);
+	if (!num || num > last || last - num >= BufferCap) return NULL;
+	return bufferSoft(window->buffer, BufferCap - 1 - (last - num));
 }
 
-static int writeString(FILE *file, const char *str) {
-	return (fwrite(str, strlen(str) + 1, 1, file) ? 0 : -1);
+static int hitCompare(const void *_a, const void *_b) {
+	const struct Hit *a = *(const struct Hit **)_a;
+	const struct Hit *b = *(const struct Hit **)_b;
+	if (a->windowHeat != b->windowHeat) return b->windowHeat - a->windowHeat;
+	if (a->heat != b->heat) return b->heat - a->heat;
+	if (a->time != b->time) return (a->time < b->time ? +1 : -1);
+	return (a->num < b->num ? +1 : (a->num > b->num ? -1 : 0));
 }
 
-int windowSave(FILE *file) {
-	int error;
+static bool hitList(const struct Hit *hit) {
+	const struct Window *window = windowByID(hit->id);
+	const struct Line *line = (window ? windowLine(window, hit->num) : NULL);
+	if (!line) return false;
+	uiFormat(
+		grep.id, Warm, &hit->time, "\3%02d%zu\3 \3%02d%.64s\3 %.900s",
+		Brown, (size_t)(hit - grep.hits) + 1,
+		idColors[hit->id], idNames[hit->id], line->str
+	);
+	return true;
+}
+
+static void grepList(void) {
+	for (; grep.listed < grep.len && grep.listed < GrepCap; ++grep.listed) {
+		hitList(&grep.hits[grep.listed]);
+	}
+}
+
+static void grepEnd(const char *verb) {
+	grepList();
+	const struct Hit **ranked = calloc(grep.len ?: 1, sizeof(*ranked));
+	if (!ranked) err(1, "calloc");
+	for (size_t i = 0; i < grep.len; ++i) {
+		ranked[i] = &grep.hits[i];
+	}
+	qsort(ranked, grep.len, sizeof(*ranked), hitCompare);
+	if (grep.len > 1) {
+		uiFormat(
+			grep.id, Warm, NULL, "Best results for \3%02d%s",
+			Brown, grep.str
+		);
+		for (size_t i = 0, n = 0; i < grep.len && n < GrepBest; ++i) {
+			n += hitList(ranked[i]);
+		}
+	}
+	free(ranked);
+	uiFormat(
+		grep.id, Warm, NULL, "Search for \3%02d%s\3 %s with %zu result%s%s",
+		Brown, grep.str, verb, grep.len, (grep.len == 1 ? "" : "s"),
+		(grep.len ? ", shown with /hit" : "")
+	);
+	free(grep.str);
+	grep.str = NULL;
+}
+
+void windowGrep(const char *str) {
+	if (grep.str) grepEnd("cancelled");
+	if (!str) return;
+	grep.str = strdup(str);
+	if (!grep.str) err(1, "strdup");
+	grep.id = idFor("<grep>");
+	grep.nids = 0;
+	for (uint num = 0; num < count; ++num) {
+		if (windows[num]->id == grep.id) continue;
+		grep.ids[grep.nids++] = windows[num]->id;
+	}
+	grep.next = 0;
+	grep.line = 0;
+	grep.len = 0;
+	grep.listed = 0;
+	uiFormat(
+		grep.id, Warm, NULL, "Searching %u windows for \3%02d%s",
+		grep.nids, Brown, grep.str
+	);
+	windowShow(windowFor(grep.id));
+}
+
+static bool grepRun(uint64_t start) {
+	if (!grep.str) return false;
+	while (grep.next < grep.nids && nsec() - start < IdleSlice) {
+		struct Window *window = windowByID(grep.ids[grep.next]);
+		const struct Line *line = NULL;
+		if (window) {
+			materialize(window);
+			line = bufferSearch(window->buffer, grep.str, grep.line, +1);
+		}
+		if (!line) {
+			grep.next++;
+			grep.line = 0;
+			continue;
+		}
+		grep.line = line->num;
+		if (grep.len == grep.cap) {
+			grep.cap = (grep.cap ? grep.cap * 2 : 64);
+			grep.hits = realloc(grep.hits, sizeof(*grep.hits) * grep.cap);
+			if (!grep.hits) err(1, "realloc");
+		}
+		grep.hits[grep.len++] = (struct Hit) {
+			.id = window->id,
+			.num = line->num,
+			.time = line->time,
+			.heat = line->heat,
+			.windowHeat = window->heat,
+		};
+	}
+	if (grep.next < grep.nids) {
+		grepList();
+		return true;
+	}
+	grepEnd("finished");
+	return false;
+}
+
+// Show the window of the nth hit of the last search, scrolled to its line.
+bool windowHit(uint n) {
+	if (!n || n > grep.len) return false;
+	const struct Hit *hit = &grep.hits[n - 1];
+	struct Window *window = windowByID(hit->id);
+	if (!window) return false;
+	windowShow(windowFor(hit->id));
+	size_t i = bufferFind(window->buffer, hit->num);
+	if (i < BufferCap) scrollTo(window, BufferCap - i);
+	return true;
+}
+
+// Do a slice of deferred work, returning true if there is more.
+bool windowIdle(void) {
+	uint64_t start = nsec();
 	for (uint num = 0; num < count; ++num) {
+		struct Window *window = windows[num];
+		if (
+			!window->lazy.data && !backlogDue(window) &&
+			window->cols == windowCols(window)
+		) {
+			continue;
+		}
+		if (nsec() - start >= IdleSlice) return true;
+		reflow(window);
+	}
+	return grepRun(start);
+}
+
+static void stateGet(const struct Window *window, uint64_t state[StateLen]) {
+	state[0] = window->mute;
+	state[1] = window->time;
+	state[2] = window->thresh;
+	state[3] = window->heat;
+	state[4] = window->unreadSoft;
+	state[5] = window->unreadWarm;
+}
+
+static void stateSet(struct Window *window, const uint64_t state[StateLen]) {
+	window->mute = state[0];
+	window->time = state[1];
+	window->thresh = state[2];
+	window->heat = state[3];
+	window->unreadSoft = state[4];
+	window->unreadWarm = state[5];
+	window->cols = windowCols(window);
+	statusMark(window);
+}
+
+struct Out {
+	FILE *file;
+	size_t size;
+	uint64_t sum;
+};
+
+static int put(struct Out *out, const void *ptr, size_t len) {
+	out->size += len;
+	out->sum = sum(out->sum, ptr, len);
+	return (len && !fwrite(ptr, len, 1, out->file) ? -1 : 0);
+}
+
+static int putU64(struct Out *out, uint64_t u) {
+	return put(out, &u, sizeof(u));
+}
+
+static int putName(struct Out *out, const struct Window *window) {
+	const char *name = idNames[window->id];
+	return putU64(out, strlen(name)) || put(out, name, strlen(name));
+}
+
+static int putLine(struct Out *out, const struct Line *line) {
+	int64_t time = line->time;
+	byte heat = line->heat;
+	uint32_t len = strlen(line->str);
+	return 0
+		|| put(out, &time, sizeof(time))
+		|| put(out, &heat, sizeof(heat))
+		|| put(out, &len, sizeof(len))
+		|| put(out, line->str, len);
+}
+
+// Windows are saved as a table of their state and where their lines are,
+// followed by the lines as length-prefixed records, so that windowLoad()
+// can map the file and leave the lines until they are needed.
+int windowSave(FILE *file) {
+	char *tableBuf = NULL, *dataBuf = NULL;
+	size_t tableLen = 0, dataLen = 0;
+	struct Out table = { open_memstream(&tableBuf, &tableLen), 0, SumInit };
+	struct Out data = { open_memstream(&dataBuf, &dataLen), 0, 0 };
+	if (!table.file || !data.file) err(1, "open_memstream");
+
+	int error = putU64(&table, count);
+	for (uint num = 0; !error && num < count; ++num) {
 		const struct Window *window = windows[num];
-		error = 0
-			|| writeString(file, idNames[window->id])
-			|| writeTime(file, window->mute)
-			|| writeTime(file, window->time)
-			|| writeTime(file, window->thresh)
-			|| writeTime(file, window->heat)
-			|| writeTime(file, window->unreadSoft)
-			|| writeTime(file, window->unreadWarm);
-		if (error) return error;
-		for (size_t i = 0; i < BufferCap; ++i) {
+		size_t offset = data.size;
+		data.sum = SumInit;
+		if (window->lazy.data) {
+			error = put(&data, window->lazy.data, window->lazy.size);
+		}
+		for (size_t i = 0; !error && i < BufferCap; ++i) {
 			const struct Line *line = bufferSoft(window->buffer, i);
-			if (!line) continue;
-			error = 0
-				|| writeTime(file, line->time)
-				|| writeTime(file, line->heat)
-				|| writeString(file, line->str);
-			if (error) return error;
+			if (line) error = putLine(&data, line);
+		}
+		uint64_t state[StateLen];
+		stateGet(window, state);
+		error = error || putName(&table, window);
+		for (size_t i = 0; !error && i < StateLen; ++i) {
+			error = putU64(&table, state[i]);
+		}
+		error = error
+			|| putU64(&table, offset)
+			|| putU64(&table, data.size - offset)
+			|| putU64(&table, data.sum);
+	}
+	error = error || fclose(table.file) || fclose(data.file);
+	struct Out out = { file, 0, 0 };
+	error = error
+		|| putU64(&out, tableLen)
+		|| putU64(&out, table.sum)
+		|| putU64(&out, dataLen)
+		|| put(&out, tableBuf, tableLen)
+		|| put(&out, dataBuf, dataLen);
+	free(tableBuf);
+	free(dataBuf);
+	return (error ? -1 : 0);
+}
+
+// Copy lines not yet loaded out of the map, before the file is rewritten.
+void windowUnmap(void) {
+	if (!map.ptr) return;
+	for (uint num = 0; num < count; ++num) {
+		struct Window *window = windows[num];
+		if (!window->lazy.data) continue;
+		byte *copy = malloc(window->lazy.size ?: 1);
+		if (!copy) err(1, "malloc");
+		memcpy(copy, window->lazy.data, window->lazy.size);
+		lazyDrop(window);
+		window->lazy.data = copy;
+	}
+}
+
+static void journaled(struct Window *window) {
+	window->journal.fresh = false;
+	window->journal.num = newest(window);
+	stateGet(window, window->journal.state);
+}
+
+static bool stateChanged(const struct Window *window) {
+	uint64_t state[StateLen];
+	stateGet(window, state);
+	return memcmp(state, window->journal.state, sizeof(state));
+}
+
+static bool changed(const struct Window *window) {
+	return window->journal.fresh
+		|| newest(window) != window->journal.num
+		|| stateChanged(window);
+}
+
+bool windowChanged(void) {
+	if (reordered) return true;
+	for (uint num = 0; num < count; ++num) {
+		if (changed(windows[num])) return true;
+	}
+	return false;
+}
+
+// Write what has changed since the last call: the order of the windows if
+// any have been opened, moved or closed, then the state and new lines of
+// each window that has changed, in the windowSave() formats. Windows opened
+// since are marked, in case one was closed and reopened in between.
+int windowJournal(FILE *file) {
+	struct Out out = { file, 0, 0 };
+	int error = putU64(&out, (reordered ? count : 0));
+	for (uint num = 0; reordered && !error && num < count; ++num) {
+		error = putName(&out, windows[num]);
+	}
+	uint n = 0;
+	for (uint num = 0; num < count; ++num) {
+		n += changed(windows[num]);
+	}
+	error = error || putU64(&out, n);
+	for (uint num = 0; !error && num < count; ++num) {
+		struct Window *window = windows[num];
+		if (!changed(window)) continue;
+		uint lines = newest(window) - window->journal.num;
+		if (lines > BufferCap) lines = BufferCap;
+		uint64_t state[StateLen];
+		stateGet(window, state);
+		error = putName(&out, window) || putU64(&out, window->journal.fresh);
+		for (size_t i = 0; !error && i < StateLen; ++i) {
+			error = putU64(&out, state[i]);
+		}
+		error = error || putU64(&out, lines);
+		for (size_t i = BufferCap - lines; !error && i < BufferCap; ++i) {
+			error = putLine(&out, bufferSoft(window->buffer, i));
 		}
-		error = writeTime(file, 0);
-		if (error) return error;
+		journaled(window);
 	}
-	return writeString(file, "");
+	reordered = false;
+	return (error ? -1 : 0);
 }
 
 static time_t readTime(FILE *file) {
@@ -626,13 +1590,105 @@ static time_t readTime(FILE *file) {
 	return time;
 }
 
+static void readBytes(FILE *file, void *ptr, size_t len) {
+	if (!len) return;
+	fread(ptr, len, 1, file);
+	if (ferror(file)) err(1, "fread");
+	if (feof(file)) errx(1, "unexpected end of save file");
+}
+
+static char *readName(FILE *file) {
+	uint64_t len = readTime(file);
+	if (len >= SIZE_MAX) errx(1, "corrupt save file");
+	char *name = malloc(len + 1);
+	if (!name) err(1, "malloc");
+	readBytes(file, name, len);
+	name[len] = '\0';
+	return name;
+}
+
 static ssize_t readString(FILE *file, char **buf, size_t *cap) {
 	ssize_t len = getdelim(buf, cap, '\0', file);
 	if (len < 0 && !feof(file)) err(1, "getdelim");
 	return len;
 }
 
+static uint64_t get(const byte **ptr, const byte *end) {
+	uint64_t u;
+	if ((size_t)(end - *ptr) < sizeof(u)) {
+		errx(1, "unexpected end of save file");
+	}
+	memcpy(&u, *ptr, sizeof(u));
+	*ptr += sizeof(u);
+	return u;
+}
+
+static void windowMap(FILE *file) {
+	uint64_t tableLen = readTime(file);
+	uint64_t tableSum = readTime(file);
+	uint64_t dataLen = readTime(file);
+	off_t start = ftello(file);
+	if (start < 0) err(1, "ftello");
+
+	struct stat st;
+	int error = fstat(fileno(file), &st);
+	if (error) err(1, "fstat");
+	if ((uint64_t)st.st_size - start < tableLen + dataLen) {
+		errx(1, "unexpected end of save file");
+	}
+	map.len = st.st_size;
+	map.ptr = mmap(NULL, map.len, PROT_READ, MAP_PRIVATE, fileno(file), 0);
+	if (map.ptr == MAP_FAILED) err(1, "mmap");
+
+	const byte *ptr = (byte *)map.ptr + start;
+	const byte *end = &ptr[tableLen];
+	const byte *data = end;
+	if (sum(SumInit, ptr, tableLen) != tableSum) {
+		errx(1, "corrupt save file");
+	}
+	for (uint64_t n = get(&ptr, end); n; --n) {
+		uint64_t len = get(&ptr, end);
+		if ((uint64_t)(end - ptr) < len) {
+			errx(1, "unexpected end of save file");
+		}
+		char *name = strndup((const char *)ptr, len);
+		if (!name) err(1, "strndup");
+		ptr += len;
+		struct Window *window = windows[windowFor(idFor(name))];
+		free(name);
+		uint64_t state[StateLen];
+		for (size_t i = 0; i < StateLen; ++i) {
+			state[i] = get(&ptr, end);
+		}
+		stateSet(window, state);
+		uint64_t offset = get(&ptr, end);
+		uint64_t size = get(&ptr, end);
+		window->lazy.sum = get(&ptr, end);
+		if (offset > dataLen || dataLen - offset < size) {
+			errx(1, "corrupt save file");
+		}
+		lazyDrop(window);
+		window->lazy.data = &data[offset];
+		window->lazy.size = size;
+		if (size) window->lazy.backlog = false;
+		map.lazy++;
+		journaled(window);
+	}
+	reordered = false;
+	if (!map.lazy) {
+		munmap(map.ptr, map.len);
+		map.ptr = NULL;
+		map.len = 0;
+	}
+	error = fseeko(file, start + tableLen + dataLen, SEEK_SET);
+	if (error) err(1, "fseeko");
+}
+
 void windowLoad(FILE *file, size_t version) {
+	if (version > 8) {
+		windowMap(file);
+		return;
+	}
 	size_t cap = 0;
 	char *buf = NULL;
 	while (0 < readString(file, &buf, &cap) && buf[0]) {
@@ -640,6 +1696,7 @@ void windowLoad(FILE *file, size_t version) {
 		if (version > 3) window->mute = readTime(file);
 		if (version > 6) window->time = readTime(file);
 		if (version > 5) window->thresh = readTime(file);
+		window->cols = windowCols(window);
 		if (version > 0) {
 			window->heat = readTime(file);
 			window->unreadSoft = readTime(file);
@@ -650,9 +1707,113 @@ void windowLoad(FILE *file, size_t version) {
 			if (!time) break;
 			enum Heat heat = (version > 2 ? readTime(file) : Cold);
 			readString(file, &buf, &cap);
-			bufferPush(window->buffer, COLS, window->thresh, heat, time, buf);
+			bufferPush(
+				window->buffer, window->cols, window->thresh,
+				heat, time, buf
+			);
 		}
+		if (newest(window)) window->lazy.backlog = false;
 		reflow(window);
+		journaled(window);
 	}
 	free(buf);
+	reordered = false;
+}
+
+// Append line records to those not yet loaded, keeping the checksum
+// streaming so that earlier corruption is still caught.
+static void lazyAppend(struct Window *window, const byte *ptr, size_t len) {
+	if (!len) return;
+	const byte *old = window->lazy.data;
+	size_t size = (old ? window->lazy.size : 0);
+	uint64_t hash = (old ? window->lazy.sum : SumInit);
+	byte *data;
+	if (old && !mapped(old)) {
+		data = realloc((byte *)old, size + len);
+		if (!data) err(1, "realloc");
+		window->lazy.data = NULL;
+	} else {
+		data = malloc(size + len);
+		if (!data) err(1, "malloc");
+		if (size) memcpy(data, old, size);
+		lazyDrop(window);
+	}
+	memcpy(&data[size], ptr, len);
+	window->lazy.data = data;
+	window->lazy.size = size + len;
+	window->lazy.sum = sum(hash, ptr, len);
+}
+
+// Apply a section written by windowJournal(). Lines are appended to those
+// not yet loaded, unless the window's buffer already holds lines.
+void windowReplay(FILE *file) {
+	uint order[IDCap];
+	uint64_t len = readTime(file);
+	if (len > IDCap) errx(1, "corrupt save file");
+	for (uint i = 0; i < len; ++i) {
+		char *name = readName(file);
+		order[i] = idFor(name);
+		free(name);
+	}
+
+	byte *buf = NULL;
+	size_t cap = 0;
+	for (uint64_t n = readTime(file); n; --n) {
+		char *name = readName(file);
+		uint id = idFor(name);
+		free(name);
+		uint num = windowFor(id);
+		if (readTime(file) && !windows[num]->journal.fresh) {
+			struct Window *window = windowRemove(num);
+			completeRemove(window->id, NULL);
+			windowFree(window);
+			num = windowFor(id);
+		}
+		struct Window *window = windows[num];
+		uint64_t state[StateLen];
+		for (size_t i = 0; i < StateLen; ++i) {
+			state[i] = readTime(file);
+		}
+		stateSet(window, state);
+		size_t size = 0;
+		for (uint64_t lines = readTime(file); lines; --lines) {
+			if (size + RecordHead > cap) {
+				cap = (cap ? 2 * cap : 4096);
+				buf = realloc(buf, cap);
+				if (!buf) err(1, "realloc");
+			}
+			readBytes(file, &buf[size], RecordHead);
+			uint32_t str;
+			memcpy(&str, &buf[size + sizeof(int64_t) + 1], sizeof(str));
+			size += RecordHead;
+			while (size + str > cap) {
+				cap *= 2;
+				buf = realloc(buf, cap);
+				if (!buf) err(1, "realloc");
+			}
+			readBytes(file, &buf[size], str);
+			size += str;
+		}
+		if (size) window->lazy.backlog = false;
+		if (window->lazy.data || !newest(window)) {
+			lazyAppend(window, buf, size);
+		} else {
+			const byte *end = recordsPush(window, buf, &buf[size]);
+			if (end < &buf[size]) errx(1, "corrupt save file");
+			reflow(window);
+		}
+		journaled(window);
+	}
+	free(buf);
+
+	for (uint i = 0; i < len; ++i) {
+		uint num = windowFor(order[i]);
+		if (num > i) windowInsert(i, windowRemove(num));
+	}
+	while (len && count > len) {
+		struct Window *window = windowRemove(len);
+		completeRemove(window->id, NULL);
+		windowFree(window);
+	}
+	reordered = false;
 }